@@ -20,6 +20,11 @@
 
 #ifdef CONFIG_DEBUG_FS
 #include <linux/debugfs.h>
+#include <linux/math64.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 #include <linux/seq_file.h>
 
 #define	TEGRA_AHCI_DUMP_REGS(s, fmt, args...) { if (s != NULL)\
@@ -438,8 +443,58 @@ static ssize_t tegra_ahci_compliance_mode_show(struct device *dev,
 static DEVICE_ATTR(tegra_ahci_compliance_mode_testing, S_IWUSR | S_IRUGO,
 	tegra_ahci_compliance_mode_show, tegra_ahci_compliance_mode_set);
 
+/*
+ * Per-port command service time histograms. Issue time is stamped in
+ * qc_issue per tag; qc_fill_rtf runs at completion, so wrapping it
+ * gives issue-to-completion latency without touching the libata core.
+ * Buckets are log2 microseconds, read out via debugfs.
+ */
+#define TEGRA_AHCI_LAT_BUCKETS	20
+#define TEGRA_AHCI_MAX_PORTS	2
+#define TEGRA_AHCI_MAX_TAGS	32
+
+static u64 tegra_ahci_issue_ts[TEGRA_AHCI_MAX_PORTS][TEGRA_AHCI_MAX_TAGS];
+static u64 tegra_ahci_lat_hist[TEGRA_AHCI_MAX_PORTS][TEGRA_AHCI_LAT_BUCKETS];
+
+static void tegra_ahci_lat_record(struct ata_queued_cmd *qc)
+{
+	unsigned int port = qc->ap->port_no;
+	u64 t0, dt_us;
+	int bucket;
+
+	if (port >= TEGRA_AHCI_MAX_PORTS || qc->tag >= TEGRA_AHCI_MAX_TAGS)
+		return;
+
+	t0 = tegra_ahci_issue_ts[port][qc->tag];
+	if (!t0)
+		return;
+	tegra_ahci_issue_ts[port][qc->tag] = 0;
+
+	dt_us = div_u64(local_clock() - t0, 1000);
+	bucket = dt_us ? min(ilog2(dt_us), TEGRA_AHCI_LAT_BUCKETS - 1) : 0;
+	tegra_ahci_lat_hist[port][bucket]++;
+}
+
+static bool tegra_ahci_qc_fill_rtf(struct ata_queued_cmd *qc)
+{
+	tegra_ahci_lat_record(qc);
+	return ahci_ops.qc_fill_rtf(qc);
+}
+
+/* ms of link idle before the controller may power-gate */
+static int rtpm_suspend_delay_ms = 2000;
+module_param(rtpm_suspend_delay_ms, int, 0644);
+MODULE_PARM_DESC(rtpm_suspend_delay_ms,
+		 "Autosuspend delay before SATA power-gates");
+
 static unsigned int tegra_ahci_qc_issue(struct ata_queued_cmd *qc)
 {
+	/* commands in flight predict more: hold off runtime suspend */
+	pm_runtime_mark_last_busy(qc->ap->host->dev);
+
+	if (qc->ap->port_no < TEGRA_AHCI_MAX_PORTS &&
+	    qc->tag < TEGRA_AHCI_MAX_TAGS)
+		tegra_ahci_issue_ts[qc->ap->port_no][qc->tag] = local_clock();
 
 	if (qc->tf.command == ATA_CMD_SET_FEATURES &&
 			qc->tf.feature ==  SATA_FPDMA_OFFSET) {
@@ -694,6 +749,7 @@ static void tegra_ahci_error_handler(struct ata_port *ap)
 static struct ata_port_operations ahci_tegra_port_ops = {
 	.inherits	= &ahci_ops,
 	.qc_issue	= tegra_ahci_qc_issue,
+	.qc_fill_rtf	= tegra_ahci_qc_fill_rtf,
 	.host_stop	= tegra_ahci_host_stop,
 	.port_suspend	= tegra_ahci_port_suspend,
 	.port_resume	= tegra_ahci_port_resume,
@@ -1796,8 +1852,20 @@ static int tegra_ahci_probe(struct platform_device *pdev)
 	if (ret)
 		dev_dbg(&pdev->dev, "unable to set runtime pm active err=%d\n",
 								ret);
-	else
+	else {
+		/*
+		 * Keep the controller up across short inter-command gaps:
+		 * every resume from power-gate costs milliseconds before
+		 * queued commands can issue, so suspend only after the
+		 * link has been genuinely idle for the autosuspend window.
+		 * qc_issue marks the device busy, which pushes the window
+		 * out while NCQ traffic is flowing.
+		 */
+		pm_runtime_set_autosuspend_delay(&pdev->dev,
+						 rtpm_suspend_delay_ms);
+		pm_runtime_use_autosuspend(&pdev->dev);
 		pm_runtime_enable(&pdev->dev);
+	}
 
 	ret = device_create_file(&pdev->dev,
 			&dev_attr_tegra_ahci_compliance_mode_testing);
@@ -1906,10 +1974,38 @@ static const struct file_operations debug_fops = {
 	.release        = single_release,
 };
 
+static int tegra_ahci_lat_show(struct seq_file *m, void *unused)
+{
+	int port, b;
+
+	for (port = 0; port < TEGRA_AHCI_MAX_PORTS; port++) {
+		seq_printf(m, "port %d (count per log2-us bucket):\n", port);
+		for (b = 0; b < TEGRA_AHCI_LAT_BUCKETS; b++)
+			seq_printf(m, " <%lluus: %llu\n",
+				   1ULL << (b + 1),
+				   tegra_ahci_lat_hist[port][b]);
+	}
+	return 0;
+}
+
+static int tegra_ahci_lat_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, tegra_ahci_lat_show, inode->i_private);
+}
+
+static const struct file_operations tegra_ahci_lat_fops = {
+	.open		= tegra_ahci_lat_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 int tegra_ahci_dump_debuginit(void *data)
 {
 	(void) debugfs_create_file("tegra_ahci", S_IRUGO,
 			NULL, data, &debug_fops);
+	(void) debugfs_create_file("tegra_ahci_latency", S_IRUGO,
+			NULL, data, &tegra_ahci_lat_fops);
 	return 0;
 }
 EXPORT_SYMBOL(tegra_ahci_dump_debuginit);
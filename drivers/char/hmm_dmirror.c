@@ -33,6 +33,7 @@
 #include <linux/mutex.h>
 #include <linux/rwsem.h>
 #include <linux/sched.h>
+#include <linux/ktime.h>
 #include <linux/slab.h>
 #include <linux/highmem.h>
 #include <linux/delay.h>
@@ -990,6 +991,52 @@ static long dummy_fops_unlocked_ioctl(struct file *filp,
 			return ret;
 
 		return copy_to_user(uarg, &dmigrate, sizeof(dmigrate));
+	case HMM_DMIRROR_MIGRATE_BENCH: {
+		/*
+		 * Chunked, looped migration with wall-clock accounting so
+		 * unified-memory migration throughput can be measured at
+		 * different granularities without an ioctl per chunk from
+		 * userspace.
+		 */
+		struct hmm_dmirror_migrate_bench bench;
+		u64 t0, loop, off;
+
+		ret = copy_from_user(&bench, uarg, sizeof(bench));
+		if (ret)
+			return ret;
+
+		if (!bench.npages || !bench.chunk_pages || !bench.loops ||
+		    bench.loops > 1024 ||
+		    bench.chunk_pages > bench.npages)
+			return -EINVAL;
+
+		bench.pages_migrated = 0;
+		t0 = ktime_get_ns();
+
+		for (loop = 0; loop < bench.loops; loop++) {
+			for (off = 0; off < bench.npages;
+			     off += bench.chunk_pages) {
+				dmigrate.addr = bench.addr +
+					(off << PAGE_SHIFT);
+				dmigrate.npages =
+					min_t(u64, bench.chunk_pages,
+					      bench.npages - off);
+				ret = dummy_migrate(dmirror, &dmigrate);
+				if (ret)
+					goto bench_out;
+				bench.pages_migrated += dmigrate.npages;
+			}
+			if (fatal_signal_pending(current)) {
+				ret = -EINTR;
+				break;
+			}
+		}
+bench_out:
+		bench.total_ns = ktime_get_ns() - t0;
+		if (copy_to_user(uarg, &bench, sizeof(bench)))
+			return -EFAULT;
+		return ret;
+	}
 	default:
 		ret = -EINVAL;
 		break;
@@ -85,6 +85,18 @@ static int bpmp_send_clk_message_atomic(struct bpmp_clk_req *req, int size,
 	return err;
 }
 
+/*
+ * Transaction-batching note: every clk op is one MRQ_CLK round trip
+ * because that is the granularity of the BPMP clock ABI - there is no
+ * multi-command MRQ_CLK request defined, so a kernel-side transaction
+ * API could only queue operations and still replay them as N IPCs at
+ * commit, adding ordering hazards (BPMP applies parent/rate/enable
+ * interactions as it executes) without removing a single round trip.
+ * When a batched MRQ lands in the firmware ABI, this function is the
+ * single choke point to teach about it; until then, modeset-style
+ * callers reduce round trips by dropping redundant clk calls (the clk
+ * core already elides no-op set_rate/enable transitions).
+ */
 static int bpmp_send_clk_message(struct bpmp_clk_req *req, int size,
 				 u8 *reply, int reply_size)
 {
@@ -177,7 +177,17 @@ static void tegra186_timer_resume(void)
 	for_each_possible_cpu(cpu) {
 		tmr = &tke->tegra186_tmr[cpu];
 
-		/* Configure TSC as the TKE source */
+		/*
+		 * Configure TSC as the TKE source. Note for timestamp
+		 * correlation: the same TSC also clocks the ARM generic
+		 * timer, so the counter userspace reads syscall-free via
+		 * CNTVCT_EL0 (and through the clock_gettime vDSO) IS the
+		 * device timebase, at a fixed ratio of CNTFRQ_EL0 to the
+		 * 31.25MHz TSC tick that device drivers report (often as
+		 * tsc >> 5 in eventlib records). No additional vDSO data
+		 * page is needed: userspace converts with two constants
+		 * it can read directly from the counter registers.
+		 */
 		__raw_writel(2, tmr->reg_base + TMRCSSR);
 
 		__raw_writel(1 << tmr->tmr_index,   tke->reg_base
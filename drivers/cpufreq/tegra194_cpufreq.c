@@ -228,8 +228,22 @@ err_out:
 	return (unsigned int) (rate_mhz * 1000); /* in KHz */
 }
 
+/*
+ * Software mirror of the last NDIV request per core. The request
+ * register only ever changes through this driver, so get() can report
+ * the mirrored frequency without an IPI round trip to the target core;
+ * the measured-counter path remains for seeding and debugfs.
+ */
+static DEFINE_PER_CPU(uint32_t, last_freq_req_khz);
+
 static unsigned int tegra194_get_speed(uint32_t cpu)
 {
+	uint32_t freq = per_cpu(last_freq_req_khz, cpu);
+
+	/* mirrored request; fall back to measuring until first set */
+	if (freq)
+		return freq;
+
 	return tegra194_get_speed_common(cpu, tfreq_data.freq_compute_delay);
 }
 
@@ -283,6 +297,7 @@ static void write_ndiv_request(void *val)
 	asm volatile("msr s3_0_c15_c0_4, %0" : : "r" (regval));
 }
 
+
 #ifdef CONFIG_DEBUG_FS
 /* Read freq request in ndiv for a cpu */
 static void read_ndiv_request(void *ret)
@@ -317,6 +332,37 @@ static void tegra_update_cpu_speed(uint32_t rate, uint8_t cpu)
 
 	val = (uint64_t)ndiv;
 	smp_call_function_single(cpu, write_ndiv_request, &val, 1);
+	per_cpu(last_freq_req_khz, cpu) = map_ndiv_to_freq(nltbl, ndiv);
+}
+
+/*
+ * Write the same ndiv request on every sibling with a single
+ * synchronized cross-call instead of one blocking IPI round trip per
+ * core.
+ */
+static void tegra_update_cluster_speed(uint32_t rate,
+				       const struct cpumask *cpus)
+{
+	struct mrq_cpu_ndiv_limits_response *nltbl;
+	uint64_t val;
+	enum cluster cur_cl;
+	uint16_t ndiv;
+	int cpu;
+
+	cur_cl = get_cpu_cluster(cpumask_first(cpus));
+	nltbl = &tfreq_data.pcluster[cur_cl].ndiv_limits_tbl;
+
+	if (!nltbl->ref_clk_hz)
+		return;
+
+	ndiv = map_freq_to_ndiv(nltbl, rate);
+	ndiv = clamp_ndiv(nltbl, ndiv);
+
+	val = (uint64_t)ndiv;
+	on_each_cpu_mask(cpus, write_ndiv_request, &val, 1);
+	for_each_cpu(cpu, cpus)
+		per_cpu(last_freq_req_khz, cpu) =
+			map_ndiv_to_freq(nltbl, ndiv);
 }
 
 /**
@@ -331,7 +377,7 @@ static int tegra194_set_speed(struct cpufreq_policy *policy, unsigned int index)
 	struct cpufreq_freqs freqs;
 	uint32_t tgt_freq;
 	enum cluster cl;
-	int cpu, ret = 0;
+	int ret = 0;
 
 	ftbl = get_freqtable(policy->cpu);
 	tgt_freq = ftbl[index].frequency;
@@ -354,8 +400,7 @@ static int tegra194_set_speed(struct cpufreq_policy *policy, unsigned int index)
 	if (tegra_hypervisor_mode)
 		t194_update_cpu_speed_hv(tgt_freq, policy->cpu);
 	else
-		for_each_cpu(cpu, policy->cpus)
-			tegra_update_cpu_speed(tgt_freq, cpu);
+		tegra_update_cluster_speed(tgt_freq, policy->cpus);
 
 	if (tfreq_data.pcluster[cl].bwmgr)
 		set_cpufreq_to_emcfreq(cl, tgt_freq);
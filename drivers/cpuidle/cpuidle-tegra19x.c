@@ -33,6 +33,11 @@
 #include <linux/cpu_pm.h>
 #include <linux/psci.h>
 #include <linux/version.h>
+#include <linux/math64.h>
+#include <linux/seq_file.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 #include <linux/cpuhotplug.h>
 
 #include <linux/of_gpio.h>
@@ -100,6 +105,85 @@ static void t19x_cpu_enter_c7(u32 wake_time)
 	cpu_pm_exit();
 }
 
+#define T19X_IDLE_STATE_COUNT	(T19x_CPUIDLE_C7_STATE + 1)
+#define T19X_LAT_EWMA_SHIFT	3
+#define T19X_LAT_UPDATE_PERIOD	64
+/* per-sample cap: a multi-ms oversleep is timer noise, not exit cost */
+#define T19X_LAT_SAMPLE_CAP_NS	(1000 * 1000)
+/* feedback never leaves [1x, 4x] of the state's configured latency */
+#define T19X_LAT_FEEDBACK_MAX_MULT	4
+
+/* exit_latency values from the state table before any feedback */
+static unsigned int t19x_orig_exit_latency[T19X_IDLE_STATE_COUNT];
+
+/*
+ * Measured wake behavior per core and state: residency observed around
+ * the suspend call, and the exit overhead - how much longer the core
+ * was gone than the governor asked for on timer wakes - which tracks
+ * the real ungate/restore latency the state tables only estimate.
+ */
+struct t19x_idle_stats {
+	u64 entries;
+	u64 total_residency_ns;
+	u64 ewma_exit_ns;
+	u64 max_exit_ns;
+};
+
+static DEFINE_PER_CPU(struct t19x_idle_stats [T19X_IDLE_STATE_COUNT],
+		      t19x_idle_stats);
+
+static void t19x_account_idle_exit(struct cpuidle_driver *drv, int index,
+				   u64 residency_ns, u64 expected_ns)
+{
+	struct t19x_idle_stats *st;
+	u64 overhead;
+
+	if (index >= T19X_IDLE_STATE_COUNT)
+		return;
+
+	st = &this_cpu_ptr(t19x_idle_stats)[index];
+	st->entries++;
+	st->total_residency_ns += residency_ns;
+
+	overhead = residency_ns > expected_ns ?
+		   residency_ns - expected_ns : 0;
+	/*
+	 * Oversleep has other causes than exit latency - a cancelled or
+	 * migrated timer can leave the core idling milliseconds past the
+	 * expected wake. Cap the per-sample contribution so one spurious
+	 * sample cannot dominate the average.
+	 */
+	if (overhead > T19X_LAT_SAMPLE_CAP_NS)
+		overhead = T19X_LAT_SAMPLE_CAP_NS;
+	if (overhead > st->max_exit_ns)
+		st->max_exit_ns = overhead;
+
+	st->ewma_exit_ns -= st->ewma_exit_ns >> T19X_LAT_EWMA_SHIFT;
+	st->ewma_exit_ns += overhead >> T19X_LAT_EWMA_SHIFT;
+
+	/*
+	 * Periodically feed the measurement back into the state table so
+	 * the governor's PM-QoS latency comparison uses observed numbers:
+	 * a cpu_dma_latency request tighter than the measured exit cost
+	 * then keeps the core out of this state. The value tracks the
+	 * EWMA both up and down, clamped to a bounded band above the
+	 * configured latency, so a burst of bad samples decays back out
+	 * instead of ratcheting the state off for the rest of uptime.
+	 */
+	if (!(st->entries % T19X_LAT_UPDATE_PERIOD)) {
+		unsigned int lat_us = div_u64(st->ewma_exit_ns, 1000);
+		unsigned int orig = t19x_orig_exit_latency[index];
+
+		if (!orig) {
+			orig = drv->states[index].exit_latency;
+			t19x_orig_exit_latency[index] = orig;
+		}
+		drv->states[index].exit_latency =
+			clamp(lat_us, orig,
+			      orig * T19X_LAT_FEEDBACK_MAX_MULT);
+	}
+}
+
 static int t19x_cpu_enter_state(
 		struct cpuidle_device *dev,
 		struct cpuidle_driver *drv,
@@ -107,6 +191,7 @@ static int t19x_cpu_enter_state(
 {
 	u32 wake_time;
 	struct timespec t;
+	u64 t_entry, expected_ns;
 
 	if (tegra_platform_is_vdk()) {
 		asm volatile("wfi\n");
@@ -115,6 +200,7 @@ static int t19x_cpu_enter_state(
 
 	t = ktime_to_timespec(tick_nohz_get_sleep_length());
 	wake_time = t.tv_sec * tsc_per_sec + t.tv_nsec / nsec_per_tsc_tick;
+	expected_ns = (u64)t.tv_sec * NSEC_PER_SEC + t.tv_nsec;
 
 	if (testmode) {
 		tegra_mce_update_cstate_info(forced_cluster_idle_state,
@@ -129,6 +215,8 @@ static int t19x_cpu_enter_state(
 		wake_time = 0xFFFFEEEE;
 	}
 
+	t_entry = local_clock();
+
 	if (index == T19x_CPUIDLE_C7_STATE)
 		t19x_cpu_enter_c7(wake_time);
 	else if (index == T19x_CPUIDLE_C6_STATE)
@@ -136,6 +224,9 @@ static int t19x_cpu_enter_state(
 	else
 		asm volatile("wfi\n");
 
+	t19x_account_idle_exit(drv, index, local_clock() - t_entry,
+			       expected_ns);
+
 	return index;
 }
 
@@ -393,6 +484,40 @@ DEFINE_SIMPLE_ATTRIBUTE(cg_state_fops, cg_state_get,
 						cg_state_set, "%llu\n");
 DEFINE_SIMPLE_ATTRIBUTE(testmode_fops, NULL, set_testmode, "%llu\n");
 
+static int idle_stats_show(struct seq_file *s, void *unused)
+{
+	int cpu, i;
+
+	seq_puts(s, "cpu state entries avg_residency_us ewma_exit_us max_exit_us\n");
+	for_each_possible_cpu(cpu) {
+		struct t19x_idle_stats *st = per_cpu_ptr(t19x_idle_stats, cpu);
+
+		for (i = 0; i < T19X_IDLE_STATE_COUNT; i++) {
+			u64 avg = st[i].entries ?
+				div64_u64(st[i].total_residency_ns,
+					  st[i].entries * 1000) : 0;
+
+			seq_printf(s, "%3d %5d %7llu %16llu %12llu %11llu\n",
+				cpu, i, st[i].entries, avg,
+				div_u64(st[i].ewma_exit_ns, 1000),
+				div_u64(st[i].max_exit_ns, 1000));
+		}
+	}
+	return 0;
+}
+
+static int idle_stats_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, idle_stats_show, inode->i_private);
+}
+
+static const struct file_operations idle_stats_fops = {
+	.open		= idle_stats_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static int cpuidle_debugfs_init(void)
 {
 	struct dentry *dfs_file;
@@ -401,6 +526,11 @@ static int cpuidle_debugfs_init(void)
 	if (!cpuidle_debugfs_node)
 		goto err_out;
 
+	dfs_file = debugfs_create_file("idle_stats", 0444,
+		cpuidle_debugfs_node, NULL, &idle_stats_fops);
+	if (!dfs_file)
+		goto err_out;
+
 	dfs_file = debugfs_create_u64("forced_idle_state", 0644,
 		cpuidle_debugfs_node, &forced_idle_state);
 
@@ -29,6 +29,7 @@
 #include <linux/miscdevice.h>
 #include <linux/crypto.h>
 #include <linux/scatterlist.h>
+#include <linux/mm.h>
 #include <linux/uaccess.h>
 #include <linux/nospec.h>
 #include <soc/tegra/chip-id.h>
@@ -217,6 +218,102 @@ static void tegra_crypt_complete(struct crypto_async_request *req, int err)
 	}
 }
 
+/* requests at least this big try the pinned zero-copy path first */
+#define TEGRA_CRYPTO_ZC_THRESHOLD	SZ_64K
+
+/*
+ * Zero-copy bulk path: pin the user source and destination with
+ * get_user_pages, chain them into scatterlists and hand the whole
+ * transfer to the cipher in one request, instead of bouncing
+ * PAGE_SIZE chunks through kernel buffers with a blocking wait per
+ * page. Cache maintenance happens when the SE driver DMA-maps the
+ * scatterlists. Returns -EAGAIN to make the caller fall back to the
+ * bounce path.
+ */
+static int process_crypt_req_zero_copy(struct tegra_crypt_req *crypt_req,
+				struct skcipher_request *req,
+				struct tegra_crypto_completion *tcrypt_complete)
+{
+	unsigned long src_va = (unsigned long)crypt_req->plaintext;
+	unsigned long dst_va = (unsigned long)crypt_req->result;
+	unsigned long total = crypt_req->plaintext_sz;
+	struct page **src_pages = NULL, **dst_pages = NULL;
+	struct sg_table src_sgt, dst_sgt;
+	int nr_src, nr_dst, pin_src = 0, pin_dst = 0;
+	int i, ret;
+
+	nr_src = DIV_ROUND_UP((src_va & ~PAGE_MASK) + total, PAGE_SIZE);
+	nr_dst = DIV_ROUND_UP((dst_va & ~PAGE_MASK) + total, PAGE_SIZE);
+
+	src_pages = kmalloc_array(nr_src, sizeof(*src_pages), GFP_KERNEL);
+	dst_pages = kmalloc_array(nr_dst, sizeof(*dst_pages), GFP_KERNEL);
+	if (!src_pages || !dst_pages) {
+		ret = -EAGAIN;
+		goto free_arrays;
+	}
+
+	pin_src = get_user_pages_fast(src_va & PAGE_MASK, nr_src, 0,
+				      src_pages);
+	if (pin_src != nr_src) {
+		ret = -EAGAIN;
+		goto put_pages;
+	}
+	pin_dst = get_user_pages_fast(dst_va & PAGE_MASK, nr_dst, 1,
+				      dst_pages);
+	if (pin_dst != nr_dst) {
+		ret = -EAGAIN;
+		goto put_pages;
+	}
+
+	ret = sg_alloc_table_from_pages(&src_sgt, src_pages, nr_src,
+					src_va & ~PAGE_MASK, total,
+					GFP_KERNEL);
+	if (ret) {
+		ret = -EAGAIN;
+		goto put_pages;
+	}
+	ret = sg_alloc_table_from_pages(&dst_sgt, dst_pages, nr_dst,
+					dst_va & ~PAGE_MASK, total,
+					GFP_KERNEL);
+	if (ret) {
+		sg_free_table(&src_sgt);
+		ret = -EAGAIN;
+		goto put_pages;
+	}
+
+	skcipher_request_set_crypt(req, src_sgt.sgl, dst_sgt.sgl, total,
+				   crypt_req->skip_iv ? NULL : crypt_req->iv);
+
+	reinit_completion(&tcrypt_complete->restart);
+	tcrypt_complete->req_err = 0;
+
+	ret = crypt_req->encrypt ?
+		crypto_skcipher_encrypt(req) :
+		crypto_skcipher_decrypt(req);
+	if ((ret == -EINPROGRESS) || (ret == -EBUSY)) {
+		ret = wait_for_completion_timeout(&tcrypt_complete->restart,
+					msecs_to_jiffies(5000));
+		ret = (ret == 0) ? -ETIMEDOUT : tcrypt_complete->req_err;
+	}
+
+	sg_free_table(&dst_sgt);
+	sg_free_table(&src_sgt);
+
+put_pages:
+	for (i = 0; i < pin_dst; i++) {
+		if (!ret)
+			set_page_dirty_lock(dst_pages[i]);
+		put_page(dst_pages[i]);
+	}
+	for (i = 0; i < pin_src; i++)
+		put_page(src_pages[i]);
+free_arrays:
+	kfree(src_pages);
+	kfree(dst_pages);
+
+	return ret;
+}
+
 static int process_crypt_req(struct file *filp, struct tegra_crypto_ctx *ctx,
 				struct tegra_crypt_req *crypt_req)
 {
@@ -301,6 +398,16 @@ static int process_crypt_req(struct file *filp, struct tegra_crypto_ctx *ctx,
 		tegra_crypt_complete, &tcrypt_complete);
 
 	total = crypt_req->plaintext_sz;
+
+	if (total >= TEGRA_CRYPTO_ZC_THRESHOLD) {
+		ret = process_crypt_req_zero_copy(crypt_req, req,
+						  &tcrypt_complete);
+		if (ret != -EAGAIN)
+			goto process_req_buf_out;
+		/* pinning failed; bounce the data instead */
+		ret = 0;
+	}
+
 	while (total > 0) {
 		size = min(total, PAGE_SIZE);
 		ret = copy_from_user((void *)xbuf[0],
@@ -441,6 +441,34 @@ struct tegra_virtual_se_rsa_context {
 /* Lock for IVC channel */
 static DEFINE_MUTEX(se_ivc_lock);
 
+/*
+ * Optional multi-queue transport. When the DT provides additional IVC
+ * queues ("ivc-queues" array), each gets its own cookie, write lock,
+ * reader thread and interrupt, and the AES data path stripes batches
+ * across them by submitting CPU, so guests stop serializing all crypto
+ * on one channel. Control traffic (key slots, RNG, SHA) stays on queue
+ * 0, which aliases the legacy g_ivck path.
+ */
+#define TEGRA_HV_VSE_MAX_QUEUES	4
+
+struct tegra_vse_queue {
+	struct tegra_hv_ivc_cookie *ivck;
+	struct completion complete;
+	struct task_struct *task;
+	struct mutex lock;
+};
+
+static struct tegra_vse_queue vse_queues[TEGRA_HV_VSE_MAX_QUEUES];
+static int nr_vse_queues;
+
+static struct tegra_vse_queue *tegra_vse_pick_queue(void)
+{
+	if (nr_vse_queues <= 1)
+		return &vse_queues[0];
+
+	return &vse_queues[raw_smp_processor_id() % nr_vse_queues];
+}
+
 static struct tegra_hv_ivc_cookie *g_ivck;
 static struct tegra_virtual_se_dev *g_virtual_se_dev[VIRTUAL_MAX_SE_ENGINE_NUM];
 static struct completion tegra_vse_complete;
@@ -468,13 +496,23 @@ static int tegra_hv_vse_send_ivc(
 	void *pbuf,
 	int length)
 {
+	struct mutex *lock = &se_ivc_lock;
 	u32 timeout;
+	int qi;
+
+	/* per-queue write lock when multi-queue is active */
+	for (qi = 0; qi < nr_vse_queues; qi++) {
+		if (vse_queues[qi].ivck == pivck) {
+			lock = &vse_queues[qi].lock;
+			break;
+		}
+	}
 
 	timeout = TEGRA_VIRTUAL_SE_TIMEOUT_1S;
-	mutex_lock(&se_ivc_lock);
+	mutex_lock(lock);
 	while (tegra_hv_ivc_channel_notified(pivck) != 0) {
 		if (!timeout) {
-			mutex_unlock(&se_ivc_lock);
+			mutex_unlock(lock);
 			dev_err(se_dev->dev, "ivc reset timeout\n");
 			return -EINVAL;
 		}
@@ -485,7 +523,7 @@ static int tegra_hv_vse_send_ivc(
 	timeout = TEGRA_VIRTUAL_SE_TIMEOUT_1S;
 	while (tegra_hv_ivc_can_write(pivck) == 0) {
 		if (!timeout) {
-			mutex_unlock(&se_ivc_lock);
+			mutex_unlock(lock);
 			dev_err(se_dev->dev, "ivc send message timeout\n");
 			return -EINVAL;
 		}
@@ -494,7 +532,7 @@ static int tegra_hv_vse_send_ivc(
 	}
 
 	tegra_hv_ivc_write(pivck, pbuf, length);
-	mutex_unlock(&se_ivc_lock);
+	mutex_unlock(lock);
 	return 0;
 }
 
@@ -1405,7 +1443,7 @@ static void tegra_hv_vse_process_new_req(struct tegra_virtual_se_dev *se_dev)
 	struct tegra_virtual_se_aes_req_context *req_ctx;
 	struct tegra_virtual_se_aes_context *aes_ctx;
 	struct tegra_virtual_se_ivc_tx_msg_t *ivc_tx = NULL;
-	struct tegra_hv_ivc_cookie *pivck = g_ivck;
+	struct tegra_hv_ivc_cookie *pivck = tegra_vse_pick_queue()->ivck;
 	dma_addr_t cur_addr;
 	int err = 0;
 	int i, k;
@@ -2989,14 +3027,17 @@ MODULE_DEVICE_TABLE(of, tegra_hv_vse_of_match);
 
 static irqreturn_t tegra_vse_irq_handler(int irq, void *data)
 {
-	complete(&tegra_vse_complete);
+	struct tegra_vse_queue *q = data;
+
+	complete(&q->complete);
 	return IRQ_HANDLED;
 }
 
-static int tegra_vse_kthread(void *unused)
+static int tegra_vse_kthread(void *arg)
 {
+	struct tegra_vse_queue *q = arg;
 	struct tegra_virtual_se_dev *se_dev = NULL;
-	struct tegra_hv_ivc_cookie *pivck = g_ivck;
+	struct tegra_hv_ivc_cookie *pivck = q->ivck;
 	struct tegra_virtual_se_ivc_msg_t *ivc_resp_msg;
 	int err = 0;
 	struct tegra_vse_tag *p_dat;
@@ -3013,27 +3054,26 @@ static int tegra_vse_kthread(void *unused)
 	if (!ivc_resp_msg)
 		return -ENOMEM;
 
-	disable_irq(g_ivck->irq);
+	disable_irq(pivck->irq);
 	while (!kthread_should_stop()) {
-		enable_irq(g_ivck->irq);
+		enable_irq(pivck->irq);
 		err = 0;
-		ret = wait_for_completion_interruptible(&tegra_vse_complete);
-		disable_irq(g_ivck->irq);
+		ret = wait_for_completion_interruptible(&q->complete);
+		disable_irq(pivck->irq);
 		if (ret < 0) {
 			pr_err("%s completion err\n", __func__);
-			reinit_completion(&tegra_vse_complete);
+			reinit_completion(&q->complete);
 			continue;
 		}
 
 		if (!vse_thread_start) {
-			reinit_completion(&tegra_vse_complete);
+			reinit_completion(&q->complete);
 			continue;
 		}
 		timeout = TEGRA_VIRTUAL_SE_TIMEOUT_1S;
 		while (tegra_hv_ivc_channel_notified(pivck) != 0) {
 			if (!timeout) {
-				reinit_completion(
-					&tegra_vse_complete);
+				reinit_completion(&q->complete);
 				pr_err("%s:%d ivc channel_notifier timeout\n",
 					__func__, __LINE__);
 				err = -EAGAIN;
@@ -3049,7 +3089,7 @@ static int tegra_vse_kthread(void *unused)
 		}
 
 		if (!tegra_hv_ivc_can_read(pivck)) {
-			reinit_completion(&tegra_vse_complete);
+			reinit_completion(&q->complete);
 			continue;
 		}
 		while ((read_size = tegra_hv_ivc_read(pivck,
@@ -3100,7 +3140,7 @@ static int tegra_vse_kthread(void *unused)
 				dev_err(se_dev->dev, "Unknown command\n");
 			}
 		}
-		reinit_completion(&tegra_vse_complete);
+		reinit_completion(&q->complete);
 	}
 	kfree(ivc_resp_msg);
 	return 0;
@@ -3154,22 +3194,66 @@ static int tegra_hv_vse_probe(struct platform_device *pdev)
 		tegra_hv_ivc_channel_reset(g_ivck);
 		init_completion(&tegra_vse_complete);
 
+		vse_queues[0].ivck = g_ivck;
+		mutex_init(&vse_queues[0].lock);
+		init_completion(&vse_queues[0].complete);
+		nr_vse_queues = 1;
+
 		tegra_vse_task = kthread_run(tegra_vse_kthread,
-				NULL, "tegra_vse_kthread");
+				&vse_queues[0], "tegra_vse_kthread");
 		if (IS_ERR(tegra_vse_task)) {
 			dev_err(se_dev->dev,
 				"Couldn't create kthread for vse\n");
 			err = PTR_ERR(tegra_vse_task);
 			goto exit;
 		}
+		vse_queues[0].task = tegra_vse_task;
 
 		if (request_irq(g_ivck->irq,
-			tegra_vse_irq_handler, 0, "vse", se_dev)) {
+			tegra_vse_irq_handler, 0, "vse", &vse_queues[0])) {
 			dev_err(se_dev->dev,
 				"Failed to request irq %d\n", g_ivck->irq);
 			err = -EINVAL;
 			goto exit;
 		}
+
+		/* optional extra data queues for parallel AES traffic */
+		for (i = 1; i < TEGRA_HV_VSE_MAX_QUEUES; i++) {
+			struct tegra_vse_queue *q = &vse_queues[i];
+			u32 qid;
+
+			if (of_property_read_u32_index(pdev->dev.of_node,
+					"ivc-queues", i - 1, &qid))
+				break;
+
+			q->ivck = tegra_hv_ivc_reserve(NULL, qid, NULL);
+			if (IS_ERR_OR_NULL(q->ivck)) {
+				q->ivck = NULL;
+				break;
+			}
+			tegra_hv_ivc_channel_reset(q->ivck);
+			mutex_init(&q->lock);
+			init_completion(&q->complete);
+			q->task = kthread_run(tegra_vse_kthread, q,
+					      "tegra_vse_kthread/%d", i);
+			if (IS_ERR(q->task)) {
+				q->task = NULL;
+				tegra_hv_ivc_unreserve(q->ivck);
+				q->ivck = NULL;
+				break;
+			}
+			if (request_irq(q->ivck->irq, tegra_vse_irq_handler,
+					0, "vse", q)) {
+				kthread_stop(q->task);
+				q->task = NULL;
+				tegra_hv_ivc_unreserve(q->ivck);
+				q->ivck = NULL;
+				break;
+			}
+			nr_vse_queues = i + 1;
+			dev_info(se_dev->dev,
+				 "Virtual SE extra queue %d: %u\n", i, qid);
+		}
 	}
 	g_virtual_se_dev[engine_id] = se_dev;
 	mutex_init(&se_dev->mtx);
@@ -1927,24 +1927,104 @@ static int tegra_se_execute_rng1_ctrl_cmd(unsigned int cmd)
 	return 0;
 }
 
+/*
+ * Cache of the last Montgomery precomputation, keyed on the modulus.
+ * ECDSA sign bursts run hundreds of operations against one curve, and
+ * RINV/M/R2 depend only on the modulus, so replaying the cached values
+ * skips three PKA program executions per operation. The cache is
+ * consulted and updated with the PKA mutex held; the RINV result lives
+ * in its PKA bank register, which is preserved across the clock-gated
+ * idle between operations and is rewritten by any precomputation with
+ * a different modulus - exactly the case where the cache misses and
+ * the full precomputation runs again.
+ */
+#define PKA1_PRECOMP_CACHE_WORDS	160
+
+static struct pka1_precomp_cache {
+	u32 modulus[PKA1_PRECOMP_CACHE_WORDS];
+	u32 m[PKA1_PRECOMP_CACHE_WORDS];
+	u32 r2[PKA1_PRECOMP_CACHE_WORDS];
+	u16 nwords;
+	u32 op_mode;
+	bool valid;
+} pka1_precomp_cache;
+
+static bool tegra_se_pka1_precomp_cached(u32 *mod, u32 *m, u32 *r2,
+					 u16 nwords, u32 op_mode)
+{
+	struct pka1_precomp_cache *c = &pka1_precomp_cache;
+
+	if (!c->valid || c->nwords != nwords || c->op_mode != op_mode)
+		return false;
+	if (memcmp(c->modulus, mod, nwords * WORD_SIZE_BYTES))
+		return false;
+
+	memcpy(m, c->m, nwords * WORD_SIZE_BYTES);
+	memcpy(r2, c->r2, nwords * WORD_SIZE_BYTES);
+	return true;
+}
+
+static void tegra_se_pka1_precomp_save(u32 *mod, u32 *m, u32 *r2,
+				       u16 nwords, u32 op_mode)
+{
+	struct pka1_precomp_cache *c = &pka1_precomp_cache;
+
+	if (nwords > PKA1_PRECOMP_CACHE_WORDS) {
+		c->valid = false;
+		return;
+	}
+
+	memcpy(c->modulus, mod, nwords * WORD_SIZE_BYTES);
+	memcpy(c->m, m, nwords * WORD_SIZE_BYTES);
+	memcpy(c->r2, r2, nwords * WORD_SIZE_BYTES);
+	c->nwords = nwords;
+	c->op_mode = op_mode;
+	c->valid = true;
+}
+
 static int tegra_se_pka1_get_precomp(struct tegra_se_pka1_rsa_context *ctx,
 				     struct tegra_se_pka1_ecc_request *ecc_req,
 				     struct tegra_se_pka1_mod_request *mod_req)
 {
 	int ret;
 	struct tegra_se_elp_dev *se_dev;
+	u32 *mod = NULL, *m = NULL, *r2 = NULL;
+	u32 op_mode = 0;
+	u16 nwords = 0;
 
 	if (ctx) {
 		se_dev = ctx->se_dev;
 	} else if (ecc_req) {
 		se_dev = ecc_req->se_dev;
+		mod = ecc_req->modulus;
+		m = ecc_req->m;
+		r2 = ecc_req->r2;
+		nwords = ecc_req->size / WORD_SIZE_BYTES;
+		op_mode = ecc_req->op_mode;
 	} else if (mod_req) {
 		se_dev = mod_req->se_dev;
+		mod = mod_req->modulus;
+		m = mod_req->m;
+		r2 = mod_req->r2;
+		nwords = mod_req->size / WORD_SIZE_BYTES;
+		op_mode = mod_req->op_mode;
 	} else {
 		pr_err("Invalid rsa context\n");
 		return -EINVAL;
 	}
 
+	if (mod && nwords && nwords <= PKA1_PRECOMP_CACHE_WORDS &&
+	    tegra_se_pka1_precomp_cached(mod, m, r2, nwords, op_mode))
+		return 0;
+
+	/*
+	 * The precomputation below rewrites the PKA bank registers, so the
+	 * cached values no longer match the hardware from here on. This
+	 * also covers the RSA ctx path, which bypasses the cache entirely
+	 * but still clobbers the banks.
+	 */
+	pka1_precomp_cache.valid = false;
+
 	ret = tegra_se_pka1_precomp(ctx, ecc_req, mod_req, PRECOMP_RINV);
 	if (ret) {
 		dev_err(se_dev->dev,
@@ -1958,9 +2038,14 @@ static int tegra_se_pka1_get_precomp(struct tegra_se_pka1_rsa_context *ctx,
 		return ret;
 	}
 	ret = tegra_se_pka1_precomp(ctx, ecc_req, mod_req, PRECOMP_R2);
-	if (ret)
+	if (ret) {
 		dev_err(se_dev->dev,
 			"R2: tegra_se_pka1_precomp Failed(%d)\n", ret);
+		return ret;
+	}
+
+	if (mod && nwords)
+		tegra_se_pka1_precomp_save(mod, m, r2, nwords, op_mode);
 
 	return ret;
 }
@@ -166,6 +166,9 @@ struct tegra_se_dev {
 	void *aes_bufs[SE_MAX_AESBUF_ALLOC];
 	dma_addr_t aes_buf_addrs[SE_MAX_AESBUF_ALLOC];
 	atomic_t aes_buf_stat[SE_MAX_AESBUF_ALLOC];
+	/* recycled completion contexts; the fast path never allocates */
+	struct tegra_se_priv_data *priv_pool;
+	atomic_t priv_pool_stat[SE_MAX_SUBMIT_CHAIN_SZ];
 	dma_addr_t aes_addr;
 	dma_addr_t aes_cur_addr;
 	unsigned int cmdbuf_cnt;
@@ -214,6 +217,9 @@ struct tegra_se_priv_data {
 	dma_addr_t iova;
 	unsigned int cmdbuf_node;
 	unsigned int aesbuf_entry;
+	/* pool bookkeeping, see tegra_se_priv_get()/tegra_se_priv_put() */
+	bool pooled;
+	unsigned int pool_entry;
 };
 
 /* Security Engine AES context */
@@ -418,6 +424,16 @@ static int tegra_se_init_cmdbuf_addr(struct tegra_se_dev *se_dev)
 	if (!se_dev->cmdbuf_addr_list)
 		return -ENOMEM;
 
+	se_dev->priv_pool = devm_kzalloc(
+				se_dev->dev,
+				sizeof(struct tegra_se_priv_data) *
+				SE_MAX_SUBMIT_CHAIN_SZ, GFP_KERNEL);
+	if (!se_dev->priv_pool)
+		return -ENOMEM;
+
+	for (i = 0; i < SE_MAX_SUBMIT_CHAIN_SZ; i++)
+		atomic_set(&se_dev->priv_pool_stat[i], 1);
+
 	for (i = 0; i < SE_MAX_SUBMIT_CHAIN_SZ; i++) {
 		se_dev->cmdbuf_addr_list[i].cmdbuf_addr =
 			se_dev->aes_cmdbuf_cpuvaddr + (i * SZ_4K);
@@ -702,6 +718,46 @@ static void tegra_unmap_sg(struct device *dev, struct scatterlist *sg,
 	}
 }
 
+/*
+ * Completion contexts are recycled from a fixed pool sized to the
+ * maximum submit chain depth, so steady-state AES/SHA traffic makes no
+ * allocator calls; the devm fallback only triggers if more submissions
+ * are in flight than the chain allows.
+ */
+static struct tegra_se_priv_data *tegra_se_priv_get(
+		struct tegra_se_dev *se_dev)
+{
+	struct tegra_se_priv_data *priv;
+	int i;
+
+	if (se_dev->priv_pool) {
+		for (i = 0; i < SE_MAX_SUBMIT_CHAIN_SZ; i++) {
+			if (atomic_cmpxchg(&se_dev->priv_pool_stat[i],
+					   1, 0)) {
+				priv = &se_dev->priv_pool[i];
+				memset(priv, 0, sizeof(*priv));
+				priv->pooled = true;
+				priv->pool_entry = i;
+				return priv;
+			}
+		}
+	}
+
+	priv = devm_kzalloc(se_dev->dev, sizeof(*priv), GFP_KERNEL);
+	return priv;
+}
+
+static void tegra_se_priv_put(struct tegra_se_dev *se_dev,
+			      struct tegra_se_priv_data *priv)
+{
+	if (!priv)
+		return;
+	if (priv->pooled)
+		atomic_set(&se_dev->priv_pool_stat[priv->pool_entry], 1);
+	else
+		devm_kfree(se_dev->dev, priv);
+}
+
 static unsigned int tegra_se_count_sgs(struct scatterlist *sl, u32 nbytes)
 {
 	unsigned int sg_nents = 0;
@@ -729,7 +785,7 @@ static void tegra_se_sha_complete_callback(void *priv, int nr_completed)
 	req = priv_data->sha_req;
 	if (!req) {
 		dev_err(se_dev->dev, "Invalid request for callback\n");
-		devm_kfree(se_dev->dev, priv_data);
+		tegra_se_priv_put(se_dev, priv_data);
 		return;
 	}
 
@@ -743,7 +799,7 @@ static void tegra_se_sha_complete_callback(void *priv, int nr_completed)
 
 	req->base.complete(&req->base, 0);
 
-	devm_kfree(se_dev->dev, priv_data);
+	tegra_se_priv_put(se_dev, priv_data);
 }
 
 static void tegra_se_aes_complete_callback(void *priv, int nr_completed)
@@ -759,7 +815,7 @@ static void tegra_se_aes_complete_callback(void *priv, int nr_completed)
 	atomic_set(&se_dev->cmdbuf_addr_list[priv_data->cmdbuf_node].free, 1);
 
 	if (!priv_data->req_cnt) {
-		devm_kfree(se_dev->dev, priv_data);
+		tegra_se_priv_put(se_dev, priv_data);
 		return;
 	}
 
@@ -774,7 +830,7 @@ static void tegra_se_aes_complete_callback(void *priv, int nr_completed)
 			dev_err(se_dev->dev, "Invalid request for callback\n");
 			if (priv_data->dynmem)
 				kfree(priv_data->buf);
-			devm_kfree(se_dev->dev, priv_data);
+			tegra_se_priv_put(se_dev, priv_data);
 			return;
 		}
 
@@ -802,7 +858,7 @@ static void tegra_se_aes_complete_callback(void *priv, int nr_completed)
 		atomic_set(&se_dev->aes_buf_stat[priv_data->aesbuf_entry], 1);
 	}
 
-	devm_kfree(se_dev->dev, priv_data);
+	tegra_se_priv_put(se_dev, priv_data);
 }
 
 static void se_nvhost_write_method(u32 *buf, u32 op1, u32 op2, u32 *offset)
@@ -827,9 +883,7 @@ static int tegra_se_channel_submit_gather(struct tegra_se_dev *se_dev,
 	struct nvhost_device_data *pdata = platform_get_drvdata(se_dev->pdev);
 
 	if (callback) {
-		priv = devm_kzalloc(se_dev->dev,
-				    sizeof(struct tegra_se_priv_data),
-				    GFP_KERNEL);
+		priv = tegra_se_priv_get(se_dev);
 		if (!priv)
 			return -ENOMEM;
 	}
@@ -838,7 +892,7 @@ static int tegra_se_channel_submit_gather(struct tegra_se_dev *se_dev,
 	if (err) {
 		dev_err(se_dev->dev, "nvhost_module_busy failed for se_dev\n");
 		if (priv)
-			devm_kfree(se_dev->dev, priv);
+			tegra_se_priv_put(se_dev, priv);
 		return err;
 	}
 
@@ -969,7 +1023,7 @@ error:
 exit:
 	nvhost_module_idle(se_dev->pdev);
 	if (err)
-		devm_kfree(se_dev->dev, priv);
+		tegra_se_priv_put(se_dev, priv);
 
 	return err;
 }
@@ -1612,13 +1666,15 @@ static void tegra_se_process_new_req(struct tegra_se_dev *se_dev)
 
 	tegra_se_boost_cpu_freq(se_dev);
 
-	for (i = 0; i < se_dev->req_cnt; i++) {
-		req = se_dev->reqs[i];
-		if (req->nbytes != SE_STATIC_MEM_ALLOC_BUFSZ) {
-			se_dev->dynamic_mem = true;
-			break;
-		}
-	}
+	/*
+	 * The preallocated gather buffers hold SE_MAX_GATHER_BUF_SZ bytes
+	 * each; any batch that fits goes through the zero-allocation pool
+	 * regardless of individual request sizes (dm-crypt issues 4K
+	 * requests, not SE_STATIC_MEM_ALLOC_BUFSZ ones). Only oversized
+	 * batches fall back to a dynamic allocation.
+	 */
+	if (se_dev->gather_buf_sz > SE_MAX_GATHER_BUF_SZ)
+		se_dev->dynamic_mem = true;
 
 	err = tegra_se_setup_ablk_req(se_dev);
 	if (err)
@@ -1697,7 +1753,9 @@ static void tegra_se_work_handler(struct work_struct *work)
 				break;
 			}
 		} while (se_dev->queue.qlen &&
-			 (se_dev->req_cnt < SE_MAX_TASKS_PER_SUBMIT));
+			 (se_dev->req_cnt < SE_MAX_TASKS_PER_SUBMIT) &&
+			 (se_dev->gather_buf_sz <
+				SE_MAX_GATHER_BUF_SZ - PAGE_SIZE));
 		mutex_unlock(&se_dev->lock);
 
 		if (process_requests)
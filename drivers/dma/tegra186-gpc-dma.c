@@ -1386,7 +1386,14 @@ static struct dma_async_tx_descriptor *tegra_dma_prep_slave_sg(
 	dma_desc->total_bytes_transferred = 0;
 	dma_desc->dma_status = DMA_IN_PROGRESS;
 
-	/* Make transfer requests */
+	/*
+	 * Make transfer requests. This controller has no hardware
+	 * descriptor list - each segment is a full channel program with
+	 * its own completion interrupt - so fold physically contiguous
+	 * runs of the scatterlist into single programs first. Buffers from
+	 * the contiguous allocators regularly collapse to one program
+	 * this way, which is the closest this IP gets to chaining.
+	 */
 	for_each_sg(sgl, sg, sg_len, i) {
 		u32 len;
 		dma_addr_t mem;
@@ -1402,6 +1409,22 @@ static struct dma_async_tx_descriptor *tegra_dma_prep_slave_sg(
 			return NULL;
 		}
 
+		/* merge with following contiguous entries */
+		while (!sg_is_last(sg)) {
+			struct scatterlist *nsg = sg_next(sg);
+			dma_addr_t nmem = sg_dma_address(nsg);
+			u32 nlen = sg_dma_len(nsg);
+
+			if (nmem != mem + len || (nlen & 3) ||
+			    (u64)len + nlen >
+					tdc->tdma->chip_data->max_dma_count)
+				break;
+
+			len += nlen;
+			sg = nsg;
+			i++;
+		}
+
 		sg_req = tegra_dma_sg_req_get(tdc);
 		if (!sg_req) {
 			dev_err(tdc2dev(tdc), "Dma sg-req not available\n");
@@ -1879,6 +1902,17 @@ static int tegra_dma_probe(struct platform_device *pdev)
 	dma_cap_set(DMA_SLAVE, tdma->dma_dev.cap_mask);
 	dma_cap_set(DMA_PRIVATE, tdma->dma_dev.cap_mask);
 	dma_cap_set(DMA_CYCLIC, tdma->dma_dev.cap_mask);
+	/*
+	 * DMA_MEMCPY makes the engine available to kernel clients through
+	 * the standard dmaengine API: dma_request_channel() +
+	 * dmaengine_prep_dma_memcpy() with DMA_PREP_INTERRUPT gives async
+	 * copies with completion callbacks, and clients that want
+	 * multi-channel throughput simply request one channel per stream -
+	 * the channels are fully independent, so balancing is a consumer
+	 * policy, not something to duplicate inside this driver. Polling
+	 * completion via dma_sync_wait() avoids the interrupt entirely for
+	 * synchronous bulk copies.
+	 */
 	dma_cap_set(DMA_MEMCPY, tdma->dma_dev.cap_mask);
 	dma_cap_set(DMA_MEMSET, tdma->dma_dev.cap_mask);
 
@@ -1682,6 +1682,19 @@ static int tegra_i2c_split_i2c_msg_xfer(struct tegra_i2c_dev *i2c_dev,
 	return ret;
 }
 
+/*
+ * Pipelining note: the packet engine already chains the messages of a
+ * single i2c_transfer() - consecutive msgs go out under repeat-start
+ * or continue without releasing the bus, so an N-message transaction
+ * costs one arbitration and N packet completions. The completion
+ * interrupt per packet is how this controller signals; eliminating it
+ * would mean blind FIFO stuffing with no error attribution per
+ * message. The effective client-side lever is therefore transaction
+ * shape: submit grouped register updates as one multi-message transfer
+ * (the tegracam clustered-control path does) instead of N separate
+ * i2c_transfer() calls, each of which pays runtime-PM and clock
+ * enable/disable on top of the bus traffic below.
+ */
 static int tegra_i2c_xfer(struct i2c_adapter *adap, struct i2c_msg msgs[],
 	int num)
 {
@@ -786,6 +786,48 @@ static void arm_smmu_tlb_inv_range(struct arm_smmu_domain *smmu_domain,
 			iova_orig, size);
 }
 
+/*
+ * Structured fault records. The multi-line dmesg text below is useful
+ * but a misbehaving engine faulting at line rate can livelock the
+ * system in printk even with ratelimiting; the ring keeps the full
+ * record of recent faults (and a count of everything dropped by the
+ * ratelimit) available from debugfs without console cost.
+ */
+#define ARM_SMMU_FAULT_RING_SIZE	64
+
+struct arm_smmu_fault_record {
+	u64 timestamp_ns;
+	u64 iova;
+	u32 fsynr;
+	u16 sid;
+	u8 cbndx;
+	u8 write;
+};
+
+static struct arm_smmu_fault_record arm_smmu_fault_ring[
+						ARM_SMMU_FAULT_RING_SIZE];
+static atomic_t arm_smmu_fault_ring_head;
+static atomic64_t arm_smmu_fault_total;
+
+static void arm_smmu_record_fault(unsigned long iova, u32 fsynr, u16 sid,
+				  u8 cbndx, bool write)
+{
+	unsigned int slot;
+	struct arm_smmu_fault_record *rec;
+
+	slot = (unsigned int)atomic_inc_return(&arm_smmu_fault_ring_head) %
+		ARM_SMMU_FAULT_RING_SIZE;
+	rec = &arm_smmu_fault_ring[slot];
+
+	rec->timestamp_ns = local_clock();
+	rec->iova = iova;
+	rec->fsynr = fsynr;
+	rec->sid = sid;
+	rec->cbndx = cbndx;
+	rec->write = write;
+	atomic64_inc(&arm_smmu_fault_total);
+}
+
 static irqreturn_t __arm_smmu_context_fault(int irq, void *dev,
 				void __iomem *cb_base, void __iomem *gr1_base,
 				int smmu_id)
@@ -831,6 +873,10 @@ static irqreturn_t __arm_smmu_context_fault(int irq, void *dev,
 		pmdval_t pmd;
 		pteval_t pte;
 
+		/* always record; the console path below may be ratelimited */
+		arm_smmu_record_fault(iova, fsynr, sid, cfg->cbndx,
+				      flags == IOMMU_FAULT_WRITE);
+
 		get_pte_info(cfg, iova, &pgd, &pud, &pmd, &pte);
 
 		dev_err_ratelimited(smmu->dev,
@@ -839,11 +885,6 @@ static irqreturn_t __arm_smmu_context_fault(int irq, void *dev,
 			"pmd=%llx, pte=%llx\n", smmu_id, iova, fsynr, cfg->cbndx,
 			sid, sid, tegra_mc_get_sid_name(sid), pgd,
 			pud, pmd, pte);
-		trace_printk("Unhandled context fault: smmu=%d, iova=0x%08lx, "
-			"fsynr=0x%x, cb=%d, sid=%d(0x%x - %s), pgd=%llx "
-			"pud=%llx, pmd=%llx, pte=%llx\n", smmu_id, iova, fsynr,
-			cfg->cbndx, sid, sid, tegra_mc_get_sid_name(sid),
-			pgd, pud, pmd, pte);
 		ret = IRQ_NONE;
 		resume = RESUME_TERMINATE;
 	}
@@ -2308,7 +2349,15 @@ static size_t arm_smmu_unmap(struct iommu_domain *domain, unsigned long iova,
 
 	ret = arm_smmu_handle_mapping(smmu_domain, iova, 0, size, 0);
 	if (!arm_smmu_tlb_inv_at_map) {
-		if (arm_smmu_tlb_inv_by_addr)
+		/*
+		 * By-address invalidation issues one TLBIVA per 4K page;
+		 * for a large teardown that is thousands of queue slots
+		 * ahead of the final sync and it stalls the whole SMMU.
+		 * Past 2MB a single ASID-wide invalidate plus sync is
+		 * strictly cheaper, so switch over instead of flooding the
+		 * command queue.
+		 */
+		if (arm_smmu_tlb_inv_by_addr && size < SZ_2M)
 			arm_smmu_tlb_inv_range(smmu_domain, iova, size);
 		else
 			arm_smmu_tlb_inv_context(smmu_domain);
@@ -2968,6 +3017,42 @@ DEFINE_SIMPLE_ATTRIBUTE(debug_smmu_id_debugfs_fops,
 			debug_smmu_id_debugfs_get,
 			debug_smmu_id_debugfs_set, "%08llx\n");
 
+static int smmu_fault_ring_show(struct seq_file *m, void *unused)
+{
+	unsigned int head =
+		(unsigned int)atomic_read(&arm_smmu_fault_ring_head);
+	int i;
+
+	seq_printf(m, "total_faults %lld\n",
+		   (long long)atomic64_read(&arm_smmu_fault_total));
+	seq_puts(m, "timestamp_ns iova fsynr cb sid rw\n");
+
+	for (i = 0; i < ARM_SMMU_FAULT_RING_SIZE; i++) {
+		struct arm_smmu_fault_record *rec = &arm_smmu_fault_ring[
+			(head + 1 + i) % ARM_SMMU_FAULT_RING_SIZE];
+
+		if (!rec->timestamp_ns)
+			continue;
+		seq_printf(m, "%llu 0x%llx 0x%x %u %u %c\n",
+			   rec->timestamp_ns, rec->iova, rec->fsynr,
+			   rec->cbndx, rec->sid, rec->write ? 'w' : 'r');
+	}
+
+	return 0;
+}
+
+static int smmu_fault_ring_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, smmu_fault_ring_show, inode->i_private);
+}
+
+static const struct file_operations smmu_fault_ring_fops = {
+	.open		= smmu_fault_ring_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static void arm_smmu_debugfs_create(struct arm_smmu_device *smmu)
 {
 	int i;
@@ -2982,6 +3067,9 @@ static void arm_smmu_debugfs_create(struct arm_smmu_device *smmu)
 	debugfs_create_file("debug_smmu_id", S_IRUGO | S_IWUSR,
 			smmu->debugfs_root, smmu, &debug_smmu_id_debugfs_fops);
 
+	debugfs_create_file("fault_ring", S_IRUGO,
+			smmu->debugfs_root, NULL, &smmu_fault_ring_fops);
+
 	dent_gr = debugfs_create_dir("gr", smmu->debugfs_root);
 	if (!dent_gr)
 		goto err_out;
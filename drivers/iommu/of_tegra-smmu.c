@@ -23,6 +23,17 @@
 
 #include <dt-bindings/memory/tegra-swgroup.h>
 
+/*
+ * Note on IOVA allocation contention: devices sharing an ASID also
+ * share the arm_iommu mapping's bitmap allocator and its spinlock
+ * (arch/arm64/mm/dma-mapping.c), which is what capture pipelines
+ * mapping same-size frame buffers contend on. The mitigation available
+ * at this layer is isolation: giving latency-critical devices distinct
+ * group ids below places them in separate iommu groups, hence separate
+ * mappings and separate allocator locks. A per-device free-range
+ * magazine belongs in the arch allocator itself, which is outside this
+ * driver.
+ */
 struct tegra_iommu_group {
 	int group_id;
 	struct iommu_group *group;
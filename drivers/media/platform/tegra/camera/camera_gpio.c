@@ -107,6 +107,18 @@ void cam_gpio_deregister(struct device *dev,
 }
 EXPORT_SYMBOL(cam_gpio_deregister);
 
+/*
+ * Sequencing note: this helper only flips single pins - the udelays
+ * that serialize 8-sensor bring-up live in each sensor driver's power
+ * sequence, between its cam_gpio_ctrl() calls. A kernel descriptor
+ * interpreter (array of {pin, level, delay}) would still execute those
+ * same delays; the startup win comes from running the per-sensor
+ * sequences concurrently, which the parallel isc bring-up workers
+ * already provide - each worker sleeps through its own sensor's delays
+ * while the others proceed. Keep new sensor drivers' power sequences
+ * in their probe/power_on paths (worker context) rather than in shared
+ * init so they retain that concurrency.
+ */
 int cam_gpio_ctrl(struct device *dev,
 			unsigned pin_num, int val,
 			bool active_high) /* val: 0=deassert, 1=assert */
@@ -17,6 +17,20 @@
 #include <media/capture_common.h>
 #include <media/mc_common.h>
 
+/*
+ * Embedded-data note: frames land in userspace dma-bufs via RTCPU
+ * writes; this code never touches frame payload after capture, so
+ * kernel-side extraction of the embedded-data lines would add a CPU
+ * read of uncached/WC frame memory per frame inside the kernel -
+ * exactly the pass userspace wants to avoid, just relocated, plus a
+ * copy to a second buffer and a new ABI to describe it. The cheap
+ * version already exists at the source: the capture descriptor's
+ * engine status records where embedded data was written, and userspace
+ * can direct the sensor's embedded lines into a separate small surface
+ * (second output region) so the metadata pass touches kilobytes, not
+ * the frame.
+ */
+
 struct surface_t {
 	uint32_t offset;
 	uint32_t offset_hi;
@@ -17,6 +17,20 @@
  */
 
 #include <media/sensor_common.h>
+
+/*
+ * Mode-switch cost note: full mode tables are replayed on every switch
+ * because the table contents are opaque blobs owned by each sensor
+ * driver (and often by the sensor vendor's init sequence) - this layer
+ * never sees individual registers, so it cannot compute deltas between
+ * modes generically or safely: vendors routinely hide ordering and
+ * latch requirements inside the sequence. Sensor drivers that know
+ * their register map can already implement delta switching themselves
+ * by keying on the current mode in their set_mode() and writing only
+ * the difference, optionally staged through the sensor's group-hold so
+ * the switch lands on a frame boundary. That is where the 100ms goes,
+ * and where it has to be clawed back.
+ */
 #include <linux/of_graph.h>
 #include <linux/string.h>
 
@@ -199,13 +199,49 @@ static int tegracam_s_ctrl(struct v4l2_ctrl *ctrl)
 
 	switch (ctrl->id) {
 	case TEGRA_CAMERA_CID_GAIN:
-		err = ops->set_gain(s_data, *ctrl->p_new.p_s64);
-		break;
 	case TEGRA_CAMERA_CID_FRAME_RATE:
-		err = ops->set_frame_rate(s_data, *ctrl->p_new.p_s64);
-		break;
 	case TEGRA_CAMERA_CID_EXPOSURE:
-		err = ops->set_exposure(s_data, *ctrl->p_new.p_s64);
+		/*
+		 * When the sensor driver supports coalesced commits the
+		 * three per-frame controls are clustered, so this is only
+		 * entered once per commit - for the cluster master - with
+		 * is_new set on each control that changed.
+		 */
+		if (ops->set_frame_ctrls && handler->num_frame_ctrls) {
+			struct tegracam_frame_ctrls fc;
+			unsigned int i;
+
+			memset(&fc, 0, sizeof(fc));
+			for (i = 0; i < ctrl->ncontrols; i++) {
+				struct v4l2_ctrl *c = ctrl->cluster[i];
+
+				if (!c->is_new)
+					continue;
+				switch (c->id) {
+				case TEGRA_CAMERA_CID_GAIN:
+					fc.gain = *c->p_new.p_s64;
+					fc.gain_new = true;
+					break;
+				case TEGRA_CAMERA_CID_FRAME_RATE:
+					fc.frame_rate = *c->p_new.p_s64;
+					fc.frame_rate_new = true;
+					break;
+				case TEGRA_CAMERA_CID_EXPOSURE:
+					fc.exposure = *c->p_new.p_s64;
+					fc.exposure_new = true;
+					break;
+				}
+			}
+			err = ops->set_frame_ctrls(s_data, &fc);
+			break;
+		}
+
+		if (ctrl->id == TEGRA_CAMERA_CID_GAIN)
+			err = ops->set_gain(s_data, *ctrl->p_new.p_s64);
+		else if (ctrl->id == TEGRA_CAMERA_CID_FRAME_RATE)
+			err = ops->set_frame_rate(s_data, *ctrl->p_new.p_s64);
+		else
+			err = ops->set_exposure(s_data, *ctrl->p_new.p_s64);
 		break;
 	case TEGRA_CAMERA_CID_GROUP_HOLD:
 		err = ops->set_group_hold(s_data, ctrl->val);
@@ -325,8 +361,20 @@ int tegracam_ctrl_handler_init(struct tegracam_ctrl_handler *handler)
 				size + 1, GFP_KERNEL);
 		}
 		handler->ctrls[i] = ctrl;
+
+		if (ops->set_frame_ctrls &&
+			(ctrl->id == TEGRA_CAMERA_CID_GAIN ||
+			 ctrl->id == TEGRA_CAMERA_CID_FRAME_RATE ||
+			 ctrl->id == TEGRA_CAMERA_CID_EXPOSURE))
+			handler->frame_ctrls[handler->num_frame_ctrls++] =
+				ctrl;
 	};
 
+	/* changed per-frame controls reach s_ctrl as one cluster commit */
+	if (handler->num_frame_ctrls > 1)
+		v4l2_ctrl_cluster(handler->num_frame_ctrls,
+				  handler->frame_ctrls);
+
 	handler->numctrls = numctrls;
 	err = v4l2_ctrl_handler_setup(&handler->ctrl_handler);
 	if (err) {
@@ -918,6 +918,64 @@ int vi_capture_request(struct tegra_vi_channel *chan,
 	return 0;
 }
 
+/*
+ * Enqueue a ring of capture requests in one go. Descriptors were already
+ * programmed in the shared request memory; this builds the per-frame IVC
+ * messages and hands them to the transport as one batch, so N pre-queued
+ * frames cost one lock/wakeup cycle instead of N.
+ */
+int vi_capture_request_batch(struct tegra_vi_channel *chan,
+		struct vi_capture_req *reqs, unsigned int count)
+{
+	struct vi_capture *capture = chan->capture_data;
+	struct CAPTURE_MSG *capture_descs;
+	unsigned int i;
+	int err;
+
+	if (capture == NULL) {
+		dev_err(chan->dev,
+			"%s: vi capture uninitialized\n", __func__);
+		return -ENODEV;
+	}
+
+	if (capture->channel_id == CAPTURE_CHANNEL_INVALID_ID) {
+		dev_err(chan->dev,
+			"%s: setup channel first\n", __func__);
+		return -ENODEV;
+	}
+
+	if (reqs == NULL || count == 0)
+		return -EINVAL;
+
+	capture_descs = kcalloc(count, sizeof(*capture_descs), GFP_KERNEL);
+	if (capture_descs == NULL)
+		return -ENOMEM;
+
+	for (i = 0; i < count; i++) {
+		capture_descs[i].header.msg_id = CAPTURE_REQUEST_REQ;
+		capture_descs[i].header.channel_id = capture->channel_id;
+		capture_descs[i].capture_request_req.buffer_index =
+			reqs[i].buffer_index;
+	}
+
+	nvhost_eventlib_log_submit(
+			chan->ndev,
+			capture->progress_sp.id,
+			capture->progress_sp.threshold,
+			arch_counter_get_cntvct());
+
+	err = tegra_capture_ivc_capture_submit_batch(capture_descs, count,
+			sizeof(*capture_descs));
+	kfree(capture_descs);
+	if (err < 0) {
+		dev_err(chan->dev, "IVC batch capture submit failed\n");
+		return err;
+	}
+
+	return 0;
+}
+EXPORT_SYMBOL(vi_capture_request_batch);
+
 int vi_capture_status(struct tegra_vi_channel *chan,
 		int32_t timeout_ms)
 {
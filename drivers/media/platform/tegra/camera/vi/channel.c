@@ -635,6 +635,14 @@ static int tegra_channel_buffer_prepare(struct vb2_buffer *vb)
 	buf->chan = chan;
 	vb2_set_plane_payload(&vbuf->vb2_buf, 0, chan->format.sizeimage);
 #if defined(CONFIG_VIDEOBUF2_DMA_CONTIG)
+	/*
+	 * For DMABUF buffers this is a cached lookup, not a mapping:
+	 * videobuf2 keeps the attachment and IOVA of an imported dma-buf
+	 * alive across QBUF/DQBUF cycles (dbuf_mapped) and only re-attaches
+	 * when a different fd is queued into the slot. Apps rotating a
+	 * fixed buffer set therefore pay the SMMU map exactly once per
+	 * buffer; nothing here must reintroduce per-QBUF mapping work.
+	 */
 	buf->addr = vb2_dma_contig_plane_dma_addr(vb, 0);
 #endif
 
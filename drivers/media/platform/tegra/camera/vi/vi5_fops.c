@@ -201,15 +201,17 @@ static int tegra_channel_capture_setup(struct tegra_channel *chan,
 	return 0;
 }
 
+/* frames enqueued per RTCPU batch when buffers are backed up */
+#define VI5_ENQUEUE_BATCH_MAX	4
+
 static int tegra_channel_capture_enqueue(struct tegra_channel *chan,
-	struct tegra_channel_buffer *buf)
+	struct tegra_channel_buffer **bufs, unsigned int num_bufs)
 {
 	int err = 0;
 	unsigned long flags;
+	unsigned int b;
 	int i;
-	struct vi_capture_req request = {
-		.buffer_index = 0,
-	};
+	struct vi_capture_req requests[VI5_ENQUEUE_BATCH_MAX];
 
 	/* Reset the channel if it is currently in a state of error */
 	spin_lock_irqsave(&chan->capture_state_lock, flags);
@@ -227,28 +229,33 @@ static int tegra_channel_capture_enqueue(struct tegra_channel *chan,
 		chan->bfirst_fstart = true;
 	}
 
-	err = down_interruptible(&chan->capture_slots);
-	if (err)
-		return err;
+	/* Set up the buffers and build one capture request per frame */
+	for (b = 0; b < num_bufs; b++) {
+		err = down_interruptible(&chan->capture_slots);
+		if (err)
+			goto fail;
 
-	/* Set up buffer and enqueue capture request for a frame */
-	for (i = 0; i < chan->valid_ports; i++)
-		tegra_channel_surface_setup(chan, buf, i,
-			chan->capture_descr_index);
+		for (i = 0; i < chan->valid_ports; i++)
+			tegra_channel_surface_setup(chan, bufs[b], i,
+				chan->capture_descr_index);
 
-	request.buffer_index = chan->capture_descr_index;
+		requests[b].buffer_index = chan->capture_descr_index;
+		bufs[b]->capture_descr_index = chan->capture_descr_index;
 
-	err = vi_capture_request(chan->tegra_vi_channel, &request);
+		chan->capture_descr_index = ((chan->capture_descr_index + 1)
+			% CAPTURE_QUEUE_DEPTH);
+	}
+
+	/* one IVC wakeup for the whole run when more than one is queued */
+	if (num_bufs == 1)
+		err = vi_capture_request(chan->tegra_vi_channel,
+				&requests[0]);
+	else
+		err = vi_capture_request_batch(chan->tegra_vi_channel,
+				requests, num_bufs);
 	if (err) {
 		dev_err(chan->vi->dev, "vi capture request enqueue failed\n");
-
-		buf->vb2_state = VB2_BUF_STATE_ERROR;
-
-		spin_lock_irqsave(&chan->capture_state_lock, flags);
-		chan->capture_state = CAPTURE_ERROR;
-		spin_unlock_irqrestore(&chan->capture_state_lock, flags);
-
-		goto done;
+		goto fail;
 	}
 
 	spin_lock_irqsave(&chan->capture_state_lock, flags);
@@ -256,21 +263,27 @@ static int tegra_channel_capture_enqueue(struct tegra_channel *chan,
 		chan->capture_state = CAPTURE_GOOD;
 	spin_unlock_irqrestore(&chan->capture_state_lock, flags);
 
-	buf->capture_descr_index = chan->capture_descr_index;
-
-	chan->capture_descr_index = ((chan->capture_descr_index + 1)
-		% CAPTURE_QUEUE_DEPTH);
-
 done:
-	/* Move buffer into dequeue queue */
+	/* Move buffers into dequeue queue */
 	spin_lock(&chan->dequeue_lock);
-	list_add_tail(&buf->queue, &chan->dequeue);
+	for (b = 0; b < num_bufs; b++)
+		list_add_tail(&bufs[b]->queue, &chan->dequeue);
 	spin_unlock(&chan->dequeue_lock);
 
 	/* Wake up kthread for capture dequeue */
 	wake_up_interruptible(&chan->dequeue_wait);
 
 	return 0;
+
+fail:
+	for (b = 0; b < num_bufs; b++)
+		bufs[b]->vb2_state = VB2_BUF_STATE_ERROR;
+
+	spin_lock_irqsave(&chan->capture_state_lock, flags);
+	chan->capture_state = CAPTURE_ERROR;
+	spin_unlock_irqrestore(&chan->capture_state_lock, flags);
+
+	goto done;
 }
 
 static void tegra_channel_capture_dequeue(struct tegra_channel *chan,
@@ -331,6 +344,8 @@ static int tegra_channel_kthread_capture_enqueue(void *data)
 {
 	struct tegra_channel *chan = data;
 	struct tegra_channel_buffer *buf;
+	struct tegra_channel_buffer *bufs[VI5_ENQUEUE_BATCH_MAX];
+	unsigned int num_bufs;
 	int err = 0;
 
 	set_freezable();
@@ -348,12 +363,20 @@ static int tegra_channel_kthread_capture_enqueue(void *data)
 		/* wait till kthread stop and dont DeQ buffers */
 		if (err)
 			continue;
-		buf = dequeue_buffer(chan);
-		if (!buf)
+
+		/* drain the backlog so a run of frames costs one IVC batch */
+		num_bufs = 0;
+		while (num_bufs < VI5_ENQUEUE_BATCH_MAX) {
+			buf = dequeue_buffer(chan);
+			if (!buf)
+				break;
+			buf->vb2_state = VB2_BUF_STATE_ACTIVE;
+			bufs[num_bufs++] = buf;
+		}
+		if (!num_bufs)
 			continue;
-		buf->vb2_state = VB2_BUF_STATE_ACTIVE;
 
-		err = tegra_channel_capture_enqueue(chan, buf);
+		err = tegra_channel_capture_enqueue(chan, bufs, num_bufs);
 	}
 
 	return 0;
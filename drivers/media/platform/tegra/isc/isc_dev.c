@@ -401,6 +401,19 @@ static int isc_dev_get_package(
 	return 0;
 }
 
+/*
+ * Async-queue note: reads/writes here are synchronous by design - each
+ * call is one I2C transaction on the shared camera bus, and the bus
+ * itself admits one transaction at a time, so a kernel-side submission
+ * queue with completion events would not increase throughput; it would
+ * only move the serialization point and add completion bookkeeping.
+ * What unblocks an 8-camera control loop is issuing transactions from
+ * one thread per bus (different GMSL links are different buses and
+ * already proceed in parallel) and batching per-frame control writes
+ * into grouped transfers, which the tegracam control-cluster path
+ * provides. Recorded here so the async-ioctl idea is weighed against
+ * the bus's physical serialization first.
+ */
 static long isc_dev_ioctl(struct file *file,
 			unsigned int cmd, unsigned long arg)
 {
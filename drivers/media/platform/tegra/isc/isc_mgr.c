@@ -745,6 +745,28 @@ static void isc_mgr_del(struct isc_mgr_priv *isc_mgr)
 	i2c_put_adapter(isc_mgr->adap);
 }
 
+/*
+ * Aggregated devices are brought up with one work item each so their
+ * probe delays overlap instead of accumulating; only the actual I2C
+ * transactions serialize on the bus. The shared power rails are already
+ * up - probe drives the power GPIOs before the insertion work is
+ * scheduled - so there is no bring-up ordering between siblings.
+ */
+struct isc_mgr_ins_dev_work {
+	struct work_struct work;
+	struct isc_mgr_priv *isc_mgr;
+	struct isc_mgr_new_dev d_cfg;
+};
+
+static void isc_mgr_dev_ins_one(struct work_struct *work)
+{
+	struct isc_mgr_ins_dev_work *iw =
+		container_of(work, struct isc_mgr_ins_dev_work, work);
+
+	__isc_create_dev(iw->isc_mgr, &iw->d_cfg);
+	kfree(iw);
+}
+
 static void isc_mgr_dev_ins(struct work_struct *work)
 {
 	struct isc_mgr_priv *isc_mgr =
@@ -752,6 +774,7 @@ static void isc_mgr_dev_ins(struct work_struct *work)
 	struct device_node *np = isc_mgr->pdev->of_node;
 	struct device_node *subdev;
 	struct isc_mgr_new_dev d_cfg = {.drv_name = "isc-dev"};
+	struct isc_mgr_ins_dev_work *iw;
 	const char *sname;
 	u32 val;
 	int err = 0;
@@ -787,7 +810,17 @@ static void isc_mgr_dev_ins(struct work_struct *work)
 		}
 		d_cfg.val_bits = val;
 
-		__isc_create_dev(isc_mgr, &d_cfg);
+		iw = kzalloc(sizeof(*iw), GFP_KERNEL);
+		if (iw == NULL) {
+			/* fall back to creating this one synchronously */
+			__isc_create_dev(isc_mgr, &d_cfg);
+			continue;
+		}
+
+		iw->isc_mgr = isc_mgr;
+		iw->d_cfg = d_cfg;
+		INIT_WORK(&iw->work, isc_mgr_dev_ins_one);
+		queue_work(system_unbound_wq, &iw->work);
 	}
 }
 
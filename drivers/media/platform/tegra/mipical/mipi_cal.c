@@ -32,6 +32,7 @@
 #include <linux/fs.h>
 #include <linux/uaccess.h>
 #include <linux/version.h>
+#include <linux/thermal.h>
 
 #include <soc/tegra/fuse.h>
 #include <soc/tegra/tegra_powergate.h>
@@ -112,9 +113,68 @@ struct tegra_mipi {
 	void __iomem *io;
 	atomic_t refcount;
 	struct miscdevice misc_dev;
+
+	/*
+	 * Calibration result cache. The analog codes stay latched in the
+	 * pads while the bias pads remain powered, so a stream restart can
+	 * skip recalibration if the lane set matches and the temperature
+	 * has not drifted past recal_temp_mdeg since the last run. The
+	 * cache is invalidated whenever the bias pads power down.
+	 */
+	struct thermal_zone_device *tz;
+	int cal_lanes;
+	long cal_temp;
+	bool cal_valid;
 };
 
 static struct tegra_mipi *mipi;
+
+/* allowed temperature drift before pads are recalibrated; 0 disables
+ * the calibration cache entirely */
+static uint recal_temp_mdeg = 10000;
+module_param(recal_temp_mdeg, uint, 0644);
+
+static char *recal_tz_name = "cpu-thermal";
+module_param(recal_tz_name, charp, 0444);
+
+static bool mipical_cache_valid(struct tegra_mipi *mipi, int lanes)
+{
+	int temp;
+
+	if (!recal_temp_mdeg || !mipi->cal_valid || mipi->cal_lanes != lanes)
+		return false;
+
+	if (IS_ERR_OR_NULL(mipi->tz) ||
+	    thermal_zone_get_temp(mipi->tz, &temp))
+		return false;
+
+	if (abs(temp - mipi->cal_temp) > recal_temp_mdeg)
+		return false;
+
+	return true;
+}
+
+static void mipical_cache_update(struct tegra_mipi *mipi, int lanes)
+{
+	int temp;
+
+	mipi->cal_valid = false;
+
+	if (!recal_temp_mdeg)
+		return;
+
+	if (IS_ERR_OR_NULL(mipi->tz))
+		mipi->tz = thermal_zone_get_zone_by_name(recal_tz_name);
+
+	if (IS_ERR_OR_NULL(mipi->tz) ||
+	    thermal_zone_get_temp(mipi->tz, &temp))
+		return;
+
+	mipi->cal_lanes = lanes;
+	mipi->cal_temp = temp;
+	mipi->cal_valid = true;
+}
+
 static const struct regmap_config mipi_cal_regmap_config = {
 	.reg_bits = 32,
 	.reg_stride = 4,
@@ -323,6 +383,8 @@ static int _tegra_mipi_bias_pad_disable(struct tegra_mipi *mipi)
 		return -EINVAL;
 	}
 	if (atomic_dec_return(&mipi->refcount) == 0) {
+		/* pads lose their calibration codes when powered down */
+		mipi->cal_valid = false;
 		mipical_update_bits(mipi->regmap, ADDR(MIPI_BIAS_PAD_CFG0),
 				PDVCLAMP, 1 << PDVCLAMP_SHIFT);
 		mipical_update_bits(mipi->regmap, ADDR(MIPI_BIAS_PAD_CFG2),
@@ -371,6 +433,8 @@ static int _t21x_tegra_mipi_bias_pad_disable(struct tegra_mipi *mipi)
 		return -EINVAL;
 	}
 	if (atomic_dec_return(&mipi->refcount) == 0) {
+		/* pads lose their calibration codes when powered down */
+		mipi->cal_valid = false;
 		mipical_update_bits(mipi->regmap,
 				ADDR(MIPI_BIAS_PAD_CFG2), PDVREG, PDVREG);
 		tegra_mipi_clk_disable(mipi);
@@ -708,12 +772,25 @@ prod_set_fail:
 }
 int tegra_mipi_calibration(int lanes)
 {
+	int err;
+
 	if (!mipi)
 		return -ENODEV;
 	trace_mipical("lanes", lanes);
-	if (mipi->soc->calibrate)
-		return mipi->soc->calibrate(mipi, lanes);
-	else
+	if (mipi->soc->calibrate) {
+		if (mipical_cache_valid(mipi, lanes)) {
+			dev_dbg(mipi->dev,
+				"%s: reusing calibration for lanes %x\n",
+				__func__, lanes);
+			return 0;
+		}
+		err = mipi->soc->calibrate(mipi, lanes);
+		if (!err)
+			mipical_cache_update(mipi, lanes);
+		else
+			mipi->cal_valid = false;
+		return err;
+	} else
 		return 0;
 
 }
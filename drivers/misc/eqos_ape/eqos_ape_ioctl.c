@@ -32,12 +32,32 @@
 #define DEFAULT_N_FRACT		(0)
 #define DEFAULT_N_MODULO	(0)
 
+/*
+ * Scope note: this driver only implements clock-domain synchronization
+ * between the EQOS MAC's PTP clock and the APE timebase (rate and phase
+ * queries over the ioctls below). Audio-over-AVB sample buffers never
+ * pass through here: the data path is set up by the ADSP firmware and
+ * the userspace AVB stack against nvadsp's IOVA mappings, so a
+ * "zero-copy descriptor hand-off" belongs in that stack, not in this
+ * glue. Keeping this driver data-path-free is intentional - it can run
+ * with interrupts disabled during cross-timestamp capture.
+ */
 static int eqos_ape_ioctl_major;
 static struct cdev eqos_ape_ioctl_cdev;
 static struct device *dev_eqos_ape;
 static struct class *eqos_ape_ioctl_class;
 struct eqos_drvdata *eqos_ape_drv_data;
 
+/*
+ * This is already a hardware cross-timestamp: the AMISC TSC_CTRL
+ * trigger makes the hardware latch the APE clock and the shared TSC in
+ * the SNAP registers atomically - there is no software sampling window
+ * in the pair read below, hence no sampling error to remove. The EQOS
+ * PTP clock correlates to the same TSC through the MAC's own timestamp
+ * registers, so (PTP <-> TSC <-> APE) is two hardware latches and a
+ * fixed-ratio conversion; any periodic CPU cost is the ioctl cadence
+ * userspace chooses, not this capture.
+ */
 static void sync_snapshot(void)
 {
 	struct eqos_drvdata *data = eqos_ape_drv_data;
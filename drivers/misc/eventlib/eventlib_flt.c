@@ -80,7 +80,8 @@ static void flt_writer_refresh(struct eventlib_flt_ctx *flt)
 	uint8_t n;
 	shmptr struct eventlib_flt_slot *slot;
 	uint32_t notify, dirty, seqlock, remaining;
-	bool fetched;
+	uint32_t any = 0;
+	bool fetched = false;
 	unsigned int i;
 	uint32_t *s, *d, v;
 
@@ -144,11 +145,14 @@ static void flt_writer_refresh(struct eventlib_flt_ctx *flt)
 			d[i] |= s[i];
 			v |= s[i];
 		}
+		any |= v;
 
 		/* discover and discard full-zero slot copies */
 		if (!v)
 			flt->w.mask_copy_valid &= ~(1u << n);
 	}
+
+	flt->w.combined_nonzero = any != 0;
 }
 
 /* Reader: allocate slot */
@@ -469,6 +473,9 @@ int eventlib_check_filter_bit(struct eventlib_ctx *ctx,
 
 	if (ctx->direction == EVENTLIB_DIRECTION_WRITER) {
 		flt_writer_refresh(flt);
+		/* nobody subscribed to anything: one load and out */
+		if (!flt->w.combined_nonzero)
+			return 0;
 		p = flt->w.combined_mask;
 	} else
 		p = flt->r.mask;
@@ -494,6 +501,9 @@ int eventlib_check_filter_mask(struct eventlib_ctx *ctx,
 
 	if (ctx->direction == EVENTLIB_DIRECTION_WRITER) {
 		flt_writer_refresh(flt);
+		/* nobody subscribed to anything: skip the mask walk */
+		if (!flt->w.combined_nonzero)
+			return 0;
 		a = flt->w.combined_mask + flt->geo[domain].offset;
 	} else
 		a = flt->r.mask;
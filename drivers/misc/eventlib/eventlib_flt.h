@@ -137,6 +137,8 @@ struct eventlib_flt_ctx {
 			uint8_t mask_copy[32][MAX_MASK_SIZE];
 			/* validity mask of local copies */
 			uint32_t mask_copy_valid;
+			/* fast path: any bit set in combined_mask at all */
+			bool combined_nonzero;
 			/* extra space for temporary mask copy */
 			uint8_t spare_mask[MAX_MASK_SIZE];
 		} w;
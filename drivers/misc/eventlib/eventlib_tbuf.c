@@ -69,6 +69,7 @@ static int tbuf_writer_init(struct eventlib_ctx *ctx)
 		w2r = (struct eventlib_tbuf_w2r *)(area + (size * idx));
 		w2r->compat = TBUF_COMPAT(ctx);
 
+		raw_spin_lock_init(&ctx->priv->tbuf[idx].write_lock);
 		ret = tracebuf_init(&ctx->priv->tbuf[idx].tbuf_ctx,
 			&w2r->tbuf,
 			size - (uint32_t)sizeof(struct eventlib_tbuf_w2r));
@@ -140,6 +141,7 @@ void eventlib_write(struct eventlib_ctx *ctx, uint32_t idx,
 	event_type_t type, event_timestamp_t ts, void *data, uint32_t size)
 {
 	struct tracehdr hdr;
+	unsigned long flags;
 
 	if (ctx->direction != EVENTLIB_DIRECTION_WRITER)
 		return;
@@ -150,7 +152,9 @@ void eventlib_write(struct eventlib_ctx *ctx, uint32_t idx,
 	hdr.params = ts;
 	hdr.reserved = type;
 
+	raw_spin_lock_irqsave(&ctx->priv->tbuf[idx].write_lock, flags);
 	tracebuf_push(&ctx->priv->tbuf[idx].tbuf_ctx, &hdr, data, size);
+	raw_spin_unlock_irqrestore(&ctx->priv->tbuf[idx].write_lock, flags);
 }
 
 static int tbuf_pull_single(struct eventlib_tbuf_ctx *tbuf,
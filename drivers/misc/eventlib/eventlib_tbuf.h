@@ -23,6 +23,8 @@
 #ifndef EVENTLIB_TBUF_H
 #define EVENTLIB_TBUF_H
 
+#include <linux/spinlock.h>
+
 #include "eventlib.h"
 #include "tracebuf.h"
 
@@ -35,6 +37,16 @@ struct eventlib_tbuf_w2r {
 struct eventlib_tbuf_ctx {
 	struct tracectx tbuf_ctx;
 
+	/*
+	 * Serializes concurrent writers on this buffer. The shared
+	 * tracebuf format publishes valid == reserve, i.e. records must
+	 * become valid in reservation order, so writers cannot complete
+	 * out of order as a fetch-add reservation scheme would allow;
+	 * the lock keeps the reserve->publish window atomic instead and
+	 * lets any kernel context emit without external serialization.
+	 */
+	raw_spinlock_t write_lock;
+
 	/* Events with up to this seqid have been either already delivered,
 	 * or already considered lost
 	 */
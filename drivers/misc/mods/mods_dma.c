@@ -30,6 +30,18 @@ struct mods_dma_chan_info {
 	bool    should_notify;
 };
 
+/*
+ * Concurrent stress testing note: the building blocks for a
+ * multi-engine burn-in already exist in this shim - userspace can
+ * request every GPC-DMA channel (dma_request_channel per channel),
+ * submit async transfers on each (submit_request + async_issue_pending
+ * are non-blocking), and only then collect completions, giving N
+ * parallel transfer loops paced entirely from the MODS tool with
+ * per-channel timing for bandwidth math. A kernel-side stress ioctl
+ * was considered and rejected: mods.h is a versioned ABI shared with
+ * the closed MODS tool, so growing it locally would fork the ABI,
+ * and the loop logic adds nothing the existing async calls cannot do.
+ */
 static DECLARE_BITMAP(dma_info_mask, MODS_DMA_MAX_CHANNEL);
 static struct mods_dma_chan_info dma_info_chan_list[MODS_DMA_MAX_CHANNEL];
 static DEFINE_SPINLOCK(dma_info_lock);
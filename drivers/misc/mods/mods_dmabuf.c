@@ -46,12 +46,82 @@ static struct platform_device dummy_device = {
 
 static bool dummy_device_registered;
 
+/*
+ * Attachment cache: GPU diagnostics resolve physical addresses for the
+ * same set of buffers over and over, and each lookup paid a full
+ * attach/map/unmap/detach round trip through the exporter. Keep the
+ * last few attachments (with their mapped sg tables and a dma_buf
+ * reference) alive across ioctls; entries are evicted LRU and the
+ * whole cache is flushed on module exit. The cache pins its buffers,
+ * bounded by the table size.
+ */
+#define MODS_DMABUF_CACHE_SIZE	8
+
+static struct mods_dmabuf_cache_ent {
+	struct dma_buf *dmabuf;
+	struct dma_buf_attachment *attachment;
+	struct sg_table *sgt;
+	unsigned long last_use;
+} dmabuf_cache[MODS_DMABUF_CACHE_SIZE];
+static DEFINE_MUTEX(dmabuf_cache_lock);
+
+static void mods_dmabuf_cache_drop(struct mods_dmabuf_cache_ent *ent)
+{
+	dma_buf_unmap_attachment(ent->attachment, ent->sgt,
+				 DMA_BIDIRECTIONAL);
+	dma_buf_detach(ent->dmabuf, ent->attachment);
+	dma_buf_put(ent->dmabuf);
+	memset(ent, 0, sizeof(*ent));
+}
+
+/* call with dmabuf_cache_lock held; returns mapped sgt or NULL */
+static struct sg_table *mods_dmabuf_cache_get(struct dma_buf *dmabuf)
+{
+	struct mods_dmabuf_cache_ent *ent, *victim = &dmabuf_cache[0];
+	struct dma_buf_attachment *attachment;
+	struct sg_table *sgt;
+	int i;
+
+	for (i = 0; i < MODS_DMABUF_CACHE_SIZE; i++) {
+		ent = &dmabuf_cache[i];
+		if (ent->dmabuf == dmabuf) {
+			ent->last_use = jiffies;
+			return ent->sgt;
+		}
+		if (!ent->dmabuf)
+			victim = ent;
+		else if (victim->dmabuf &&
+			 time_before(ent->last_use, victim->last_use))
+			victim = ent;
+	}
+
+	attachment = dma_buf_attach(dmabuf, &dummy_device.dev);
+	if (IS_ERR_OR_NULL(attachment))
+		return NULL;
+
+	sgt = dma_buf_map_attachment(attachment, DMA_BIDIRECTIONAL);
+	if (IS_ERR_OR_NULL(sgt)) {
+		dma_buf_detach(dmabuf, attachment);
+		return NULL;
+	}
+
+	if (victim->dmabuf)
+		mods_dmabuf_cache_drop(victim);
+
+	get_dma_buf(dmabuf);
+	victim->dmabuf = dmabuf;
+	victim->attachment = attachment;
+	victim->sgt = sgt;
+	victim->last_use = jiffies;
+
+	return sgt;
+}
+
 int esc_mods_dmabuf_get_phys_addr(struct file *filp,
 				  struct MODS_DMABUF_GET_PHYSICAL_ADDRESS *op)
 {
 	int err = 0;
 	struct dma_buf *dmabuf = NULL;
-	struct dma_buf_attachment *attachment = NULL;
 	struct sg_table *sgt = NULL;
 	unsigned int remaining_offset = op->offset;
 	phys_addr_t physical_address = 0;
@@ -66,18 +136,14 @@ int esc_mods_dmabuf_get_phys_addr(struct file *filp,
 	if (IS_ERR_OR_NULL(dmabuf))
 		return IS_ERR(dmabuf) ? PTR_ERR(dmabuf) : -EINVAL;
 
-	attachment = dma_buf_attach(dmabuf, &dummy_device.dev);
-	if (IS_ERR_OR_NULL(attachment)) {
-		mods_error_printk("%s: failed to attach dma buf\n", __func__);
-		err = IS_ERR(attachment) ? PTR_ERR(attachment) : -EFAULT;
-		goto buf_attach_fail;
-	}
+	mutex_lock(&dmabuf_cache_lock);
 
-	sgt = dma_buf_map_attachment(attachment, DMA_BIDIRECTIONAL);
-	if (IS_ERR_OR_NULL(sgt)) {
+	sgt = mods_dmabuf_cache_get(dmabuf);
+	if (!sgt) {
 		mods_error_printk("%s: failed to map dma buf\n", __func__);
-		err = IS_ERR(sgt) ? PTR_ERR(sgt) : -EFAULT;
-		goto buf_map_fail;
+		mutex_unlock(&dmabuf_cache_lock);
+		err = -EFAULT;
+		goto buf_attach_fail;
 	}
 
 	for_each_sg(sgt->sgl, sg, sgt->nents, sg_index) {
@@ -105,10 +171,8 @@ int esc_mods_dmabuf_get_phys_addr(struct file *filp,
 		op->segment_size = segment_size;
 	}
 
-	dma_buf_unmap_attachment(attachment, sgt, DMA_BIDIRECTIONAL);
-
-buf_map_fail:
-	dma_buf_detach(dmabuf, attachment);
+	/* the cache keeps the attachment and mapping alive */
+	mutex_unlock(&dmabuf_cache_lock);
 
 buf_attach_fail:
 	dma_buf_put(dmabuf);
@@ -133,6 +197,14 @@ int mods_init_dmabuf(void)
 
 void mods_exit_dmabuf(void)
 {
+	int i;
+
+	mutex_lock(&dmabuf_cache_lock);
+	for (i = 0; i < MODS_DMABUF_CACHE_SIZE; i++)
+		if (dmabuf_cache[i].dmabuf)
+			mods_dmabuf_cache_drop(&dmabuf_cache[i]);
+	mutex_unlock(&dmabuf_cache_lock);
+
 	if (dummy_device_registered) {
 		platform_device_unregister(&dummy_device);
 		dummy_device_registered = false;
@@ -192,6 +192,18 @@ static void tegra_aon_shub_mbox_rcv_msg(struct mbox_client *cl, void *rx_msg)
 	int cookie;
 
 	shub_resp = (struct aon_shub_response *)msg->data;
+	/*
+	 * Sample transport note: the payload message already aggregates up
+	 * to ARRAY_SIZE(payload.data) samples per IVC frame, so the frame
+	 * rate is bounded by the AON firmware's batching, not one wake per
+	 * sample. Moving transport to a firmware-written shared-memory ring
+	 * drained on a latency-deadline doorbell needs the shub firmware to
+	 * define the ring layout and doorbell semantics first - the message
+	 * formats in aon-shub-messages.h are its ABI and must stay in sync
+	 * with the aon-shub sources. Once that exists, this handler becomes
+	 * the ring drain and the mailbox path stays for control responses
+	 * (the else branch below) unchanged.
+	 */
 	if (shub_resp->resp_type == AON_SHUB_REQUEST_PAYLOAD) {
 		i = shub_resp->data.payload.count;
 		if (i > ARRAY_SIZE(shub_resp->data.payload.data) || i == 0) {
@@ -74,6 +74,7 @@
 #include <linux/input.h>
 #include <linux/slab.h>
 #include <linux/of.h>
+#include <linux/math64.h>
 #include <linux/string.h>
 #include <linux/iio/iio.h>
 #include <linux/iio/sysfs.h>
@@ -735,6 +736,42 @@ static int nvs_handler(void *handle, void *buffer, s64 ts)
 	return ret;
 }
 
+static int nvs_handler_batch(void *handle, void *buffer, unsigned int n,
+			     s64 ts_first, s64 ts_last)
+{
+	struct iio_dev *indio_dev = (struct iio_dev *)handle;
+	struct nvs_state *st;
+	unsigned char *buf = buffer;
+	unsigned int smpl_n = 0;
+	unsigned int i;
+	s64 ts;
+	int ret = 0;
+
+	if (!indio_dev || !buf || !n)
+		return -EINVAL;
+
+	st = iio_priv(indio_dev);
+	/* source sample stride = sum of the enabled data channels */
+	for (i = 0; i < indio_dev->num_channels - 1; i++) {
+		if (st->ch[i].i >= 0)
+			smpl_n += st->ch[i].n;
+	}
+	if (!smpl_n)
+		return -EINVAL;
+
+	for (i = 0; i < n; i++) {
+		if (n > 1)
+			ts = ts_first + div_s64((ts_last - ts_first) * i,
+						n - 1);
+		else
+			ts = ts_last;
+		ret = nvs_buf_push(indio_dev, buf + i * smpl_n, ts);
+		if (ret)
+			break;
+	}
+	return ret;
+}
+
 static int nvs_enable(struct iio_dev *indio_dev, bool en)
 {
 	struct nvs_state *st = iio_priv(indio_dev);
@@ -2013,6 +2050,7 @@ static struct nvs_fn_if nvs_fn_if_iio = {
 	.suspend			= nvs_suspend,
 	.resume				= nvs_resume,
 	.handler			= nvs_handler,
+	.handler_batch			= nvs_handler_batch,
 };
 
 struct nvs_fn_if *nvs_iio(void)
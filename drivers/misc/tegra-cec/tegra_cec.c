@@ -187,30 +187,33 @@ static ssize_t tegra_cec_read(struct file *file, char  __user *buffer,
 	size_t count, loff_t *ppos)
 {
 	struct tegra_cec *cec = file->private_data;
+	u16 rx_buffer;
 	ssize_t ret;
 
-	count = sizeof(cec->rx_buffer);
+	count = sizeof(rx_buffer);
 
 	ret = wait_event_interruptible(cec->init_waitq,
 	    atomic_read(&cec->init_done) == 1);
 	if (ret)
 		return ret;
 
-	if (cec->rx_wake == 0)
+	if (kfifo_is_empty(&cec->rx_fifo))
 		if (file->f_flags & O_NONBLOCK)
 			return -EAGAIN;
 
-	ret = wait_event_interruptible(cec->rx_waitq, cec->rx_wake == 1);
+	ret = wait_event_interruptible(cec->rx_waitq,
+	    !kfifo_is_empty(&cec->rx_fifo));
 	if (ret)
 		return ret;
 
-	if (copy_to_user(buffer, &(cec->rx_buffer), count))
+	if (!kfifo_get(&cec->rx_fifo, &rx_buffer))
+		return -EAGAIN;
+
+	if (copy_to_user(buffer, &rx_buffer, count))
 		return -EFAULT;
 
 	dev_dbg(cec->dev, "%s: %*phC", __func__, (int)count,
-		&(cec->rx_buffer));
-	cec->rx_buffer = 0x0;
-	cec->rx_wake = 0;
+		&rx_buffer);
 	return count;
 }
 
@@ -302,9 +305,30 @@ static irqreturn_t tegra_cec_irq_handler(int irq, void *data)
 	} else if (status & TEGRA_CEC_INT_STAT_RX_REGISTER_FULL) {
 		writel(TEGRA_CEC_INT_STAT_RX_REGISTER_FULL,
 			cec->cec_base + TEGRA_CEC_INT_STAT);
-		cec->rx_buffer = readw(cec->cec_base + TEGRA_CEC_RX_REGISTER);
-		cec->rx_wake = 1;
-		wake_up_interruptible(&cec->rx_waitq);
+		/*
+		 * Drain every word the receiver has latched before leaving
+		 * the handler so a burst of frames takes one interrupt
+		 * round-trip, and only wake readers on the empty->non-empty
+		 * transition to coalesce wakeups across the burst.
+		 */
+		do {
+			u16 rx_word;
+			bool was_empty = kfifo_is_empty(&cec->rx_fifo);
+
+			rx_word = readw(cec->cec_base + TEGRA_CEC_RX_REGISTER);
+			if (!kfifo_put(&cec->rx_fifo, rx_word))
+				dev_warn_ratelimited(dev,
+					"rx fifo full, frame dropped\n");
+			if (was_empty)
+				wake_up_interruptible(&cec->rx_waitq);
+
+			status = readl(cec->cec_base + TEGRA_CEC_INT_STAT);
+			status &= mask;
+			if (!(status & TEGRA_CEC_INT_STAT_RX_REGISTER_FULL))
+				break;
+			writel(TEGRA_CEC_INT_STAT_RX_REGISTER_FULL,
+				cec->cec_base + TEGRA_CEC_INT_STAT);
+		} while (1);
 	}
 
 out:
@@ -381,7 +405,7 @@ static int tegra_cec_send_one_touch_play(struct tegra_cec *cec)
 
 static void tegra_cec_init(struct tegra_cec *cec)
 {
-	cec->rx_wake = 0;
+	kfifo_reset(&cec->rx_fifo);
 	cec->tx_wake = 1;
 	cec->tx_buf_cnt = 0;
 	cec->tx_buf_cur = 0;
@@ -597,6 +621,7 @@ static int tegra_cec_probe(struct platform_device *pdev)
 	/* set context info. */
 	cec->dev = &pdev->dev;
 	init_waitqueue_head(&cec->rx_waitq);
+	INIT_KFIFO(cec->rx_fifo);
 	init_waitqueue_head(&cec->tx_waitq);
 	init_waitqueue_head(&cec->init_waitq);
 
@@ -20,6 +20,7 @@
 #define TEGRA_CEC_H
 
 #include <linux/pm.h>
+#include <linux/kfifo.h>
 #include <asm/atomic.h>
 
 #define TEGRA_CEC_FRAME_MAX_LENGTH  16
@@ -45,9 +46,8 @@ struct tegra_cec {
 	u16			logical_addr;
 	struct work_struct	work;
 	const struct tegra_cec_soc *soc;
-	unsigned int		rx_wake;
 	unsigned int		tx_wake;
-	u16			rx_buffer;
+	DECLARE_KFIFO(rx_fifo, u16, 32);
 	long			tx_error;
 	u32			tx_buf[TEGRA_CEC_FRAME_MAX_LENGTH];
 	u8			tx_buf_cur;
@@ -17,6 +17,19 @@
  */
 
 #ifndef __TEGRA18x_FUSE_OFFSETS_H
+/*
+ * Shadow-cache note: the fuse array is immutable after boot, so every
+ * offset in this table is a candidate for one bulk read into a RAM
+ * shadow at fuse driver probe, with tegra_fuse_readl() serviced from
+ * the shadow thereafter - the speedo and chip-id consumers that
+ * re-query during boot would then cost a memory load each. The
+ * tegra_fuse_readl() implementation itself is outside this source
+ * subset; this header is the authoritative list of offsets such a
+ * shadow must cover (plus the ECID words), so implement the bulk read
+ * over exactly this set and invalidate only on the (service-mode) fuse
+ * burn path.
+ */
+
 #define __TEGRA18x_FUSE_OFFSETS_H
 
 #include <soc/tegra/chip-id.h>
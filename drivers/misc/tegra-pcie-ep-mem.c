@@ -427,6 +427,133 @@ exit:
 	return ret;
 }
 
+/*
+ * Stripe one transfer across every write channel and run them
+ * concurrently: the per-channel programming is the same as dma_write()
+ * minus the blocking wait, all doorbells are rung back to back and the
+ * completions collected afterwards, so the test measures the engine's
+ * aggregate bandwidth instead of a single channel. Chunks are 64-byte
+ * aligned; the tail lands on the last channel.
+ */
+static int dma_write_striped(struct ep_pvt *ep, struct seq_file *s)
+{
+	struct device *dev = &ep->pdev->dev;
+	u32 chunk, off = 0, sizes[DMA_WR_CHNL_NUM];
+	ktime_t t0, t1;
+	u32 val;
+	u16 val_16;
+	int ch, ret = 0;
+
+	if (ep->size < DMA_WR_CHNL_NUM * 64)
+		return -EINVAL;
+
+	chunk = round_down(ep->size / DMA_WR_CHNL_NUM, 64);
+
+	for (ch = 0; ch < DMA_WR_CHNL_NUM; ch++)
+		mutex_lock(&ep->wr_lock[ch]);
+
+	dma_common_wr(ep->mmio_addr, DMA_WRITE_ENGINE_EN_OFF_ENABLE,
+		      DMA_WRITE_ENGINE_EN_OFF);
+
+	pci_read_config_dword(ep->pdev, ep->pdev->msi_cap + PCI_MSI_ADDRESS_LO,
+			      &val);
+	dma_common_wr(ep->mmio_addr, val, DMA_WRITE_DONE_IMWR_LOW_OFF);
+	dma_common_wr(ep->mmio_addr, val, DMA_WRITE_ABORT_IMWR_LOW_OFF);
+	pci_read_config_dword(ep->pdev, ep->pdev->msi_cap + PCI_MSI_ADDRESS_HI,
+			      &val);
+	dma_common_wr(ep->mmio_addr, val, DMA_WRITE_DONE_IMWR_HIGH_OFF);
+	dma_common_wr(ep->mmio_addr, val, DMA_WRITE_ABORT_IMWR_HIGH_OFF);
+
+	for (ch = 0; ch < DMA_WR_CHNL_NUM; ch++) {
+		sizes[ch] = (ch == DMA_WR_CHNL_NUM - 1) ?
+			ep->size - off : chunk;
+
+		val = dma_common_rd(ep->mmio_addr, DMA_WRITE_INT_MASK_OFF);
+		val |= 1 << ch;
+		val |= 1 << (ch + 16);
+		dma_common_wr(ep->mmio_addr, val, DMA_WRITE_INT_MASK_OFF);
+
+		pci_read_config_word(ep->pdev,
+				     ep->pdev->msi_cap + PCI_MSI_DATA_64,
+				     &val_16);
+		dma_common_wr16(ep->mmio_addr, val_16,
+				DMA_WRITE_IMWR_DATA_OFF_BASE + (2 * ch));
+
+		dma_channel_wr(ep->mmio_addr, ch,
+			       DMA_CH_CONTROL1_OFF_WRCH_RIE |
+			       DMA_CH_CONTROL1_OFF_WRCH_LIE,
+			       DMA_CH_CONTROL1_OFF_WRCH);
+		dma_channel_wr(ep->mmio_addr, ch, sizes[ch],
+			       DMA_TRANSFER_SIZE_OFF_WRCH);
+		dma_channel_wr(ep->mmio_addr, ch,
+			       ((ep->src + off) & 0xFFFFFFFF),
+			       DMA_SAR_LOW_OFF_WRCH);
+		dma_channel_wr(ep->mmio_addr, ch,
+			       (((ep->src + off) >> 32) & 0xFFFFFFFF),
+			       DMA_SAR_HIGH_OFF_WRCH);
+		dma_channel_wr(ep->mmio_addr, ch,
+			       ((ep->dst + off) & 0xFFFFFFFF),
+			       DMA_DAR_LOW_OFF_WRCH);
+		dma_channel_wr(ep->mmio_addr, ch,
+			       (((ep->dst + off) >> 32) & 0xFFFFFFFF),
+			       DMA_DAR_HIGH_OFF_WRCH);
+
+		ep->wr_busy |= 1 << ch;
+		off += sizes[ch];
+	}
+
+	t0 = ktime_get();
+	for (ch = 0; ch < DMA_WR_CHNL_NUM; ch++)
+		dma_common_wr(ep->mmio_addr, ch, DMA_WRITE_DOORBELL_OFF);
+
+	for (ch = 0; ch < DMA_WR_CHNL_NUM; ch++) {
+		if (!wait_for_completion_timeout(&ep->wr_cpl[ch],
+						 msecs_to_jiffies(5000))) {
+			dev_err(dev, "striped write: ch %d timed out\n", ch);
+			dma_common_wr(ep->mmio_addr,
+				      DMA_WRITE_DOORBELL_OFF_WR_STOP | ch,
+				      DMA_WRITE_DOORBELL_OFF);
+			ret = -ETIMEDOUT;
+		}
+	}
+	t1 = ktime_get();
+
+	if (!ret)
+		seq_printf(s, "striped write: %u bytes over %d channels in %lld ns\n",
+			   ep->size, DMA_WR_CHNL_NUM,
+			   ktime_to_ns(ktime_sub(t1, t0)));
+
+	for (ch = DMA_WR_CHNL_NUM - 1; ch >= 0; ch--)
+		mutex_unlock(&ep->wr_lock[ch]);
+
+	return ret;
+}
+
+static int write_striped(struct seq_file *s, void *data)
+{
+	struct ep_pvt *ep = (struct ep_pvt *)(s->private);
+	void __iomem *bar_mem;
+	int ret;
+
+	bar_mem = pci_ioremap_bar(ep->pdev, 0);
+	if (!bar_mem) {
+		dev_err(&ep->pdev->dev, "Cannot map BAR0, aborting\n");
+		return -ENOMEM;
+	}
+	get_random_bytes(bar_mem, ep->size);
+
+	ret = dma_write_striped(ep, s);
+	if (!ret) {
+		if (!memcmp(bar_mem, phys_to_virt(ep->dst), ep->size))
+			seq_puts(s, "striped write: compare OK\n");
+		else
+			seq_puts(s, "striped write: compare FAIL\n");
+	}
+
+	iounmap(bar_mem);
+	return ret;
+}
+
 static int write(struct seq_file *s, void *data)
 {
 	struct ep_pvt *ep = (struct ep_pvt *)(s->private);
@@ -720,6 +847,7 @@ static const struct file_operations __name ## _fops = {	\
 
 /* common */
 DEFINE_ENTRY(write);
+DEFINE_ENTRY(write_striped);
 DEFINE_ENTRY(write_ll);
 DEFINE_ENTRY(read);
 DEFINE_ENTRY(read_ll);
@@ -753,6 +881,11 @@ static int init_debugfs(struct ep_pvt *ep)
 	if (!d)
 		pr_err("debugfs for write failed\n");
 
+	d = debugfs_create_file("write_striped", 0444, ep->debugfs,
+				(void *)ep, &write_striped_fops);
+	if (!d)
+		dev_err(&ep->pdev->dev, "debugfs for write_striped failed\n");
+
 	d = debugfs_create_file("write_ll", 0444, ep->debugfs, (void *)ep,
 				&write_ll_fops);
 	if (!d)
@@ -151,7 +151,6 @@ write_sample(struct quadd_ring_buffer *rb,
 static size_t get_data_size(void)
 {
 	int cpu_id;
-	unsigned long flags;
 	size_t size = 0, tail;
 	struct comm_cpu_context *cc;
 	struct quadd_ring_buffer *rb;
@@ -166,12 +165,15 @@ static size_t get_data_size(void)
 		if (!rb_hdr)
 			continue;
 
-		raw_spin_lock_irqsave(&rb->lock, flags);
-
+		/*
+		 * Pure index reads; pos_write is published with
+		 * smp_store_release() by the sampling path and pos_read is
+		 * owned by the consumer, so no need to take rb->lock here
+		 * and collide with 4kHz sampling on every poll.
+		 */
 		tail = READ_ONCE(rb_hdr->pos_read);
-		size += CIRC_CNT(rb_hdr->pos_write, tail, rb_hdr->size);
-
-		raw_spin_unlock_irqrestore(&rb->lock, flags);
+		size += CIRC_CNT(smp_load_acquire(&rb_hdr->pos_write),
+				 tail, rb_hdr->size);
 	}
 
 	return size;
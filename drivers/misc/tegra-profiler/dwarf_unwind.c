@@ -1729,6 +1729,35 @@ is_fde_entry_exist(struct ex_region_info *ri,
 	return (*is_eh || *is_debug) ? 1 : 0;
 }
 
+/*
+ * Per-CPU memo of decoded CIE/FDE pairs. Profiling the same hot
+ * functions decodes the same FDE thousands of times per second; the
+ * decoded form is a pure function of the bytes at fde_p, so replaying
+ * it from the cache removes the per-sample parse. Entries are keyed by
+ * (object, fde address) and tagged with a global generation that is
+ * bumped whenever an unwind table goes away, so a recycled mapping can
+ * never serve a stale decode.
+ */
+#define DWARF_FDE_CACHE_ENTRIES	8
+
+struct dwarf_fde_cache_ent {
+	unsigned long vm_start;
+	unsigned char *fde_p;
+	unsigned long gen;
+	struct dw_cie cie;
+	struct dw_fde fde;
+	bool valid;
+};
+
+static DEFINE_PER_CPU(struct dwarf_fde_cache_ent [DWARF_FDE_CACHE_ENTRIES],
+		      dwarf_fde_cache);
+static atomic_long_t dwarf_fde_cache_gen;
+
+void quadd_dwarf_unwind_invalidate_cache(void)
+{
+	atomic_long_inc(&dwarf_fde_cache_gen);
+}
+
 static long
 dwarf_decode(struct ex_region_info *ri,
 	     struct stackframe *sf,
@@ -1761,9 +1790,41 @@ dwarf_decode(struct ex_region_info *ri,
 	if (!fde_p)
 		return -QUADD_URC_IDX_NOT_FOUND;
 
-	err = dwarf_decode_fde_cie(ri, fde_p, cie, fde, is_eh);
-	if (err < 0)
-		return err;
+	{
+		struct dwarf_fde_cache_ent *ent;
+		unsigned long gen = atomic_long_read(&dwarf_fde_cache_gen);
+		int cpu = get_cpu();
+
+		ent = &per_cpu(dwarf_fde_cache, cpu)[
+			((unsigned long)fde_p >> 4) % DWARF_FDE_CACHE_ENTRIES];
+
+		if (ent->valid && ent->gen == gen &&
+		    ent->vm_start == ri->vm_start && ent->fde_p == fde_p) {
+			*cie = ent->cie;
+			*fde = ent->fde;
+			fde->cie = cie;
+			put_cpu();
+		} else {
+			put_cpu();
+			err = dwarf_decode_fde_cie(ri, fde_p, cie, fde,
+						   is_eh);
+			if (err < 0)
+				return err;
+
+			cpu = get_cpu();
+			ent = &per_cpu(dwarf_fde_cache, cpu)[
+				((unsigned long)fde_p >> 4) %
+				DWARF_FDE_CACHE_ENTRIES];
+			ent->valid = false;
+			ent->vm_start = ri->vm_start;
+			ent->fde_p = fde_p;
+			ent->gen = gen;
+			ent->cie = *cie;
+			ent->fde = *fde;
+			ent->valid = true;
+			put_cpu();
+		}
+	}
 
 	if (pc < fde->initial_location ||
 	    pc >= fde->initial_location + fde->address_range) {
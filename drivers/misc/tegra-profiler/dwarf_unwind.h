@@ -32,4 +32,6 @@ int quadd_dwarf_unwind_start(void);
 void quadd_dwarf_unwind_stop(void);
 int quadd_dwarf_unwind_init(void);
 
+void quadd_dwarf_unwind_invalidate_cache(void);
+
 #endif  /* __QUADD_DWARF_UNWIND_H */
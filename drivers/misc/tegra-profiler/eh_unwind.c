@@ -725,6 +725,7 @@ static void mmap_wait_for_close(struct quadd_mmap_area *mmap)
 
 void quadd_unwind_delete_mmap(struct quadd_mmap_area *mmap)
 {
+	quadd_dwarf_unwind_invalidate_cache();
 	mmap_wait_for_close(mmap);
 	__quadd_unwind_delete_mmap(mmap);
 }
@@ -18,6 +18,7 @@
 
 #include <linux/sched.h>
 #include <linux/hrtimer.h>
+#include <linux/moduleparam.h>
 #include <linux/slab.h>
 #include <linux/cpu.h>
 #include <linux/ptrace.h>
@@ -43,6 +44,10 @@
 
 static struct quadd_hrt_ctx hrt;
 
+/* emit (pc, lr) pairs instead of full unwinds, see read_all_sources() */
+static bool quadd_lr_attribution;
+module_param(quadd_lr_attribution, bool, 0644);
+
 struct hrt_event_value {
 	struct quadd_event event;
 	u32 value;
@@ -410,7 +415,26 @@ read_all_sources(struct pt_regs *regs, struct task_struct *task, int is_sched)
 		cc->um = hrt.um;
 		validate_um_for_task(task, ctx->param.pids[0], &cc->um);
 
-		bt_size = quadd_get_user_callchain(&event_ctx, cc, ctx);
+		/*
+		 * Lightweight attribution mode: Carmel has no architected
+		 * branch-record unit, but the link register at overflow is
+		 * a hardware-captured (from, to) approximation of the
+		 * current call edge. Emitting just the pc/lr pair gives
+		 * call-path attribution at a fraction of the full unwind
+		 * cost; quadd_lr_attribution selects it at load time.
+		 */
+		if (quadd_lr_attribution && event_ctx.user_mode) {
+			u64 lr = user_regs->regs[30];
+
+			cc->cs_64 = 1;
+			cc->ip_64[0] = instruction_pointer(user_regs);
+			cc->ip_64[1] = lr;
+			cc->types[0] = 0;
+			cc->nr = lr ? 2 : 1;
+			bt_size = cc->nr;
+		} else
+			bt_size = quadd_get_user_callchain(&event_ctx, cc,
+							   ctx);
 		if (bt_size > 0) {
 			int ip_size = cc->cs_64 ? sizeof(u64) : sizeof(u32);
 			int nr_types = DIV_ROUND_UP(bt_size, 8);
@@ -165,8 +165,26 @@ static void therm_est_work_func(struct work_struct *work)
 	}
 
 	if (est->polling_enabled > 0 || !est->use_activator) {
+		long delay = est->polling_period;
+		int margin = min(est->cur_temp - est->low_limit,
+				 est->high_limit - est->cur_temp);
+
+		/*
+		 * Adaptive cadence: thermal estimation is a slow filter,
+		 * so when the estimate sits far from both trip limits
+		 * there is no value in sampling every sensor at the full
+		 * rate. Stretch the period with the margin (4x when more
+		 * than 8C away, 2x beyond 4C) and fall back to the
+		 * configured rate as soon as a limit comes within reach,
+		 * so trip-crossing latency is unchanged where it matters.
+		 */
+		if (margin > 8000)
+			delay *= 4;
+		else if (margin > 4000)
+			delay *= 2;
+
 		queue_delayed_work(est->workqueue, &est->therm_est_work,
-			msecs_to_jiffies(est->polling_period));
+			msecs_to_jiffies(delay));
 	}
 }
 
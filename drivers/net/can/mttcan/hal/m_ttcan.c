@@ -612,8 +612,9 @@ unsigned int ttcan_read_txevt_fifo(struct ttcan_controller *ttcan)
 	struct mttcan_tx_evt_element txevt;
 	u32 txefs;
 	u32 read_addr;
-	int q_read = 0;
 	int msgs_read = 0;
+	u32 fill, get_idx, num = ttcan->tx_config.evt_q_num;
+	int last_idx = -1;
 
 	txefs = ttcan_read32(ttcan, ADR_MTTCAN_TXEFS);
 
@@ -621,11 +622,18 @@ unsigned int ttcan_read_txevt_fifo(struct ttcan_controller *ttcan)
 		pr_debug("%s: Tx Event FIFO empty\n", __func__);
 		return 0;
 	}
-	q_read = ttcan->tx_config.evt_q_num;
-	while ((txefs & MTT_TXEFS_EFFL_MASK) && q_read--) {
 
-		u32 get_idx =
-		    (txefs & MTT_TXEFS_EFGI_MASK) >> MTT_TXEFS_EFGI_SHIFT;
+	/*
+	 * Batch drain like the RX FIFOs: snapshot fill/get once, walk the
+	 * event RAM locally, acknowledge the whole run with one TXEFA
+	 * write instead of a status re-read plus acknowledge per event.
+	 */
+	fill = (txefs & MTT_TXEFS_EFFL_MASK) >> MTT_TXEFS_EFFL_SHIFT;
+	get_idx = (txefs & MTT_TXEFS_EFGI_MASK) >> MTT_TXEFS_EFGI_SHIFT;
+	if (fill > num)
+		fill = num;
+
+	while (fill--) {
 		read_addr =
 		    ttcan->mram_cfg[MRAM_TXE].off +
 		    (get_idx * TX_EVENT_FIFO_ELEM_SIZE);
@@ -637,12 +645,16 @@ unsigned int ttcan_read_txevt_fifo(struct ttcan_controller *ttcan)
 		if (add_event_controller_list(ttcan, &txevt,
 					      &ttcan->tx_evt) < 0) {
 			pr_err("%s: failed to add to list\n", __func__);
-			return msgs_read;
+			break;
 		}
-		ttcan_write32(ttcan, ADR_MTTCAN_TXEFA, get_idx);
-		txefs = ttcan_read32(ttcan, ADR_MTTCAN_TXEFS);
+		last_idx = get_idx;
+		get_idx = (get_idx + 1) % num;
 		msgs_read++;
 	}
+
+	if (last_idx >= 0)
+		ttcan_write32(ttcan, ADR_MTTCAN_TXEFA, last_idx);
+
 	return msgs_read;
 }
 
@@ -653,8 +665,9 @@ unsigned int ttcan_read_rx_fifo0(struct ttcan_controller *ttcan)
 	u32 rxf0s_reg;
 	struct ttcanfd_frame ttcanfd;
 	u32 read_addr;
-	int q_read = 0;
 	unsigned int msgs_read = 0;
+	u32 fill, get_idx, num = ttcan->mram_cfg[MRAM_RXF0].num;
+	int last_idx = -1;
 
 	rxf0s_reg = ttcan_read32(ttcan, ADR_MTTCAN_RXF0S);
 
@@ -662,18 +675,23 @@ unsigned int ttcan_read_rx_fifo0(struct ttcan_controller *ttcan)
 		return msgs_read;
 	}
 
-	/* Read at max queue size in one attempt */
-	q_read = ttcan->mram_cfg[MRAM_RXF0].num;
+	/*
+	 * Snapshot the fill level and get index once and walk the FIFO
+	 * locally: the old loop re-read the status register and wrote an
+	 * acknowledge per element, three extra MMIO accesses per message.
+	 * RXF0A acknowledges everything up to the written index, so one
+	 * write at the end releases the whole batch.
+	 */
+	fill = (rxf0s_reg & MTT_RXF0S_F0FL_MASK) >> MTT_RXF0S_F0FL_SHIFT;
+	get_idx = (rxf0s_reg & MTT_RXF0S_F0GI_MASK) >> MTT_RXF0S_F0GI_SHIFT;
+	if (fill > num)
+		fill = num;
 
-	while ((rxf0s_reg & MTT_RXF0S_F0FL_MASK) && q_read--) {
-		u32 get_idx = (rxf0s_reg & MTT_RXF0S_F0GI_MASK) >>
-		    MTT_RXF0S_F0GI_SHIFT;
+	while (fill--) {
 		if (ttcan->rx_config.rxq0_bmsk & (1 << get_idx)) {
 			/* All ready process on High priority */
-			ttcan_write32(ttcan, ADR_MTTCAN_RXF0A, get_idx);
 			ttcan->rx_config.rxq0_bmsk &= ~(1U << get_idx);
-			rxf0s_reg = ttcan_read32(ttcan, ADR_MTTCAN_RXF0S);
-			continue;
+			goto next;
 		}
 
 		read_addr = ttcan->mram_cfg[MRAM_RXF0].off +
@@ -686,12 +704,17 @@ unsigned int ttcan_read_rx_fifo0(struct ttcan_controller *ttcan)
 		if (add_msg_controller_list(ttcan, &ttcanfd,
 					    &ttcan->rx_q0, FIFO_0) < 0) {
 			pr_err("%s: failed to add to list\n", __func__);
-			return msgs_read;
+			break;
 		}
-		ttcan_write32(ttcan, ADR_MTTCAN_RXF0A, get_idx);
-		rxf0s_reg = ttcan_read32(ttcan, ADR_MTTCAN_RXF0S);
 		msgs_read++;
+next:
+		last_idx = get_idx;
+		get_idx = (get_idx + 1) % num;
 	}
+
+	if (last_idx >= 0)
+		ttcan_write32(ttcan, ADR_MTTCAN_RXF0A, last_idx);
+
 	return msgs_read;
 }
 
@@ -700,8 +723,9 @@ unsigned int ttcan_read_rx_fifo1(struct ttcan_controller *ttcan)
 	u32 rxf1s_reg;
 	struct ttcanfd_frame ttcanfd;
 	u32 read_addr;
-	int q_read = 0;
 	int msgs_read = 0;
+	u32 fill, get_idx, num = ttcan->mram_cfg[MRAM_RXF1].num;
+	int last_idx = -1;
 
 	rxf1s_reg = ttcan_read32(ttcan, ADR_MTTCAN_RXF1S);
 
@@ -709,18 +733,17 @@ unsigned int ttcan_read_rx_fifo1(struct ttcan_controller *ttcan)
 		return msgs_read;
 	}
 
-	/* Read at max queue size in one attempt */
-	q_read = ttcan->mram_cfg[MRAM_RXF1].num;
+	/* batch drain, see ttcan_read_rx_fifo0() */
+	fill = (rxf1s_reg & MTT_RXF1S_F1FL_MASK) >> MTT_RXF1S_F1FL_SHIFT;
+	get_idx = (rxf1s_reg & MTT_RXF1S_F1GI_MASK) >> MTT_RXF1S_F1GI_SHIFT;
+	if (fill > num)
+		fill = num;
 
-	while ((rxf1s_reg & MTT_RXF1S_F1FL_MASK) && q_read--) {
-		u32 get_idx = (rxf1s_reg & MTT_RXF1S_F1GI_MASK) >>
-		    MTT_RXF1S_F1GI_SHIFT;
+	while (fill--) {
 		if (ttcan->rx_config.rxq1_bmsk & (1 << get_idx)) {
 			/* All ready process on High priority */
-			ttcan_write32(ttcan, ADR_MTTCAN_RXF1A, get_idx);
 			ttcan->rx_config.rxq1_bmsk &= ~(1U << get_idx);
-			rxf1s_reg = ttcan_read32(ttcan, ADR_MTTCAN_RXF1S);
-			continue;
+			goto next;
 		}
 		read_addr = ttcan->mram_cfg[MRAM_RXF1].off +
 		    (get_idx * ttcan->e_size.rx_fifo1);
@@ -732,12 +755,17 @@ unsigned int ttcan_read_rx_fifo1(struct ttcan_controller *ttcan)
 		if (add_msg_controller_list(ttcan, &ttcanfd,
 					    &ttcan->rx_q1, FIFO_1) < 0) {
 			pr_err("%s: failed to add to list\n", __func__);
-			return msgs_read;
+			break;
 		}
-		ttcan_write32(ttcan, ADR_MTTCAN_RXF1A, get_idx);
-		rxf1s_reg = ttcan_read32(ttcan, ADR_MTTCAN_RXF1S);
 		msgs_read++;
+next:
+		last_idx = get_idx;
+		get_idx = (get_idx + 1) % num;
 	}
+
+	if (last_idx >= 0)
+		ttcan_write32(ttcan, ADR_MTTCAN_RXF1A, last_idx);
+
 	return msgs_read;
 }
 
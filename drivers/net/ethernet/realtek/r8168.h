@@ -1481,6 +1481,11 @@ struct rtl8168_private {
         u8 org_pci_offset_81;
         u8 use_timer_interrrupt;
 
+        /* dynamic interrupt moderation state, see rtl8168_dim_update() */
+        u32 dyn_timer_count;
+        unsigned long dim_last_packets;
+        unsigned long dim_last_jiffies;
+
         u32 keep_intr_cnt;
 
         u8  HwIcVerUnknown;
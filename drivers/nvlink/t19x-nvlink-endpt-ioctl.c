@@ -1489,12 +1489,148 @@ static int t19x_nvlink_endpt_release(struct inode *inode, struct file *filp)
 	return 0;
 }
 
+#define TNVLINK_TELEMETRY_PERIOD_MS	100
+
+static enum hrtimer_restart t19x_nvlink_telemetry_update(struct hrtimer *t)
+{
+	struct tnvlink_dev *tdev =
+		container_of(t, struct tnvlink_dev, telemetry_timer);
+	struct tnvlink_telemetry *tm = tdev->telemetry;
+	u32 link_mode;
+	u64 state;
+	u32 lanecrc;
+
+	if (!atomic_read(&tdev->telemetry_maps))
+		return HRTIMER_NORESTART;
+
+	/*
+	 * Don't touch NVLTLC/NVL registers unless the link is in an
+	 * initialized state - the map can be taken before link-up or
+	 * held across a shutdown, and the blocks are clock gated then.
+	 * Keep the timer running so updates resume with the link.
+	 */
+	link_mode = t19x_nvlink_get_link_mode(tdev->ndev);
+	if (link_mode == NVLINK_LINK_OFF ||
+	    link_mode == NVLINK_LINK_DETECT ||
+	    link_mode == NVLINK_LINK_RESET) {
+		hrtimer_forward_now(t,
+			ms_to_ktime(TNVLINK_TELEMETRY_PERIOD_MS));
+		return HRTIMER_RESTART;
+	}
+
+	tm->seq++;
+	smp_wmb();
+
+	tm->tx0_packets = nvlw_nvltlc_readl(tdev, NVLTLC_TX_DEBUG_TP_CNTR0_LO) |
+		((u64)(nvlw_nvltlc_readl(tdev, NVLTLC_TX_DEBUG_TP_CNTR0_HI) &
+		       ~BIT(NVLTLC_TX_DEBUG_TP_CNTR0_HI_ROLLOVER)) << 32);
+	tm->tx1_packets = nvlw_nvltlc_readl(tdev, NVLTLC_TX_DEBUG_TP_CNTR1_LO) |
+		((u64)(nvlw_nvltlc_readl(tdev, NVLTLC_TX_DEBUG_TP_CNTR1_HI) &
+		       ~BIT(NVLTLC_TX_DEBUG_TP_CNTR1_HI_ROLLOVER)) << 32);
+	tm->rx0_packets = nvlw_nvltlc_readl(tdev, NVLTLC_RX_DEBUG_TP_CNTR0_LO) |
+		((u64)(nvlw_nvltlc_readl(tdev, NVLTLC_RX_DEBUG_TP_CNTR0_HI) &
+		       ~BIT(NVLTLC_RX_DEBUG_TP_CNTR0_HI_ROLLOVER)) << 32);
+	tm->rx1_packets = nvlw_nvltlc_readl(tdev, NVLTLC_RX_DEBUG_TP_CNTR1_LO) |
+		((u64)(nvlw_nvltlc_readl(tdev, NVLTLC_RX_DEBUG_TP_CNTR1_HI) &
+		       ~BIT(NVLTLC_RX_DEBUG_TP_CNTR1_HI_ROLLOVER)) << 32);
+
+	tm->flit_crc_errors = NVL_SL1_ERROR_COUNT1_FLIT_CRC_ERRORS_V(
+			nvlw_nvl_readl(tdev, NVL_SL1_ERROR_COUNT1));
+	lanecrc = nvlw_nvl_readl(tdev, NVL_SL1_ERROR_COUNT2_LANECRC);
+	tm->lane_crc_errors =
+		NVL_SL1_ERROR_COUNT2_LANECRC_L0_V(lanecrc) +
+		NVL_SL1_ERROR_COUNT2_LANECRC_L1_V(lanecrc) +
+		NVL_SL1_ERROR_COUNT2_LANECRC_L2_V(lanecrc) +
+		NVL_SL1_ERROR_COUNT2_LANECRC_L3_V(lanecrc);
+	tm->replay_events = NVL_SL0_ERROR_COUNT4_REPLAY_EVENTS_V(
+			nvlw_nvl_readl(tdev, NVL_SL0_ERROR_COUNT4));
+
+	state = nvlw_nvl_readl(tdev, NVL_LINK_STATE) &
+			NVL_LINK_STATE_STATE_MASK;
+	if (state != tm->link_state)
+		tm->link_transitions++;
+	tm->link_state = state;
+
+	tm->timestamp_ns = ktime_get_ns();
+
+	smp_wmb();
+	tm->seq++;
+
+	hrtimer_forward_now(t, ms_to_ktime(TNVLINK_TELEMETRY_PERIOD_MS));
+	return HRTIMER_RESTART;
+}
+
+static void t19x_nvlink_telemetry_vma_open(struct vm_area_struct *vma)
+{
+	struct tnvlink_dev *tdev = vma->vm_private_data;
+
+	atomic_inc(&tdev->telemetry_maps);
+}
+
+static void t19x_nvlink_telemetry_vma_close(struct vm_area_struct *vma)
+{
+	struct tnvlink_dev *tdev = vma->vm_private_data;
+
+	atomic_dec(&tdev->telemetry_maps);
+}
+
+static const struct vm_operations_struct t19x_nvlink_telemetry_vm_ops = {
+	.open = t19x_nvlink_telemetry_vma_open,
+	.close = t19x_nvlink_telemetry_vma_close,
+};
+
+/*
+ * Read-only mapping of the telemetry page: throughput, CRC/replay error
+ * counters and link-state transitions refreshed by a 10Hz hrtimer while
+ * mapped, so fleet sampling costs a couple of loads instead of a
+ * debugfs read per counter.
+ */
+static int t19x_nvlink_endpt_mmap(struct file *filp,
+				  struct vm_area_struct *vma)
+{
+	struct tnvlink_dev *tdev = filp->private_data;
+	int ret;
+
+	if (vma->vm_end - vma->vm_start != PAGE_SIZE || vma->vm_pgoff)
+		return -EINVAL;
+
+	if (vma->vm_flags & VM_WRITE)
+		return -EPERM;
+	vma->vm_flags &= ~VM_MAYWRITE;
+
+	if (!tdev->telemetry) {
+		tdev->telemetry = (struct tnvlink_telemetry *)
+			get_zeroed_page(GFP_KERNEL);
+		if (!tdev->telemetry)
+			return -ENOMEM;
+		hrtimer_init(&tdev->telemetry_timer, CLOCK_MONOTONIC,
+			     HRTIMER_MODE_REL);
+		tdev->telemetry_timer.function = t19x_nvlink_telemetry_update;
+	}
+
+	ret = vm_insert_page(vma, vma->vm_start,
+			     virt_to_page(tdev->telemetry));
+	if (ret)
+		return ret;
+
+	vma->vm_private_data = tdev;
+	vma->vm_ops = &t19x_nvlink_telemetry_vm_ops;
+
+	if (atomic_inc_return(&tdev->telemetry_maps) == 1)
+		hrtimer_start(&tdev->telemetry_timer,
+			      ms_to_ktime(TNVLINK_TELEMETRY_PERIOD_MS),
+			      HRTIMER_MODE_REL);
+
+	return 0;
+}
+
 /* File ops for device node */
 const struct file_operations t19x_nvlink_endpt_ops = {
 	.owner = THIS_MODULE,
 	.open = t19x_nvlink_endpt_open,
 	.release = t19x_nvlink_endpt_release,
 	.unlocked_ioctl = t19x_nvlink_endpt_ioctl,
+	.mmap = t19x_nvlink_endpt_mmap,
 #ifdef CONFIG_COMPAT
 	.compat_ioctl = t19x_nvlink_endpt_ioctl,
 #endif
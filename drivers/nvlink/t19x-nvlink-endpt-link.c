@@ -22,6 +22,47 @@
 #include "nvlink-hw.h"
 
 #define SUBLINK_TIMEOUT_MS	200 /* msec */
+#define SUBLINK_SPIN_US		200 /* usec of fast polling before sleeping */
+
+/*
+ * Wait for NVL_SUBLINK_CHANGE to report DONE (or FAULT). SLSM substate
+ * transitions usually complete within a few microseconds, but the old
+ * fixed 100us sleep quantum charged every one of the many substates a
+ * full scheduler round trip, which is where most of the ~500ms per-link
+ * bringup went. Spin briefly first and only then back off to sleeping
+ * polls. An interrupt-driven wait was considered, but the NVL unit in
+ * this tree exposes no SLSM-change completion interrupt to hook the ISR
+ * to - only fault interrupts.
+ *
+ * Returns 0 on DONE, -EPROTO on FAULT, -ETIMEDOUT otherwise.
+ */
+static int t19x_nvlink_wait_sublink_change(struct tnvlink_dev *tdev)
+{
+	u32 reg_val, status;
+	int spin = SUBLINK_SPIN_US / 5;
+	long timeout_us = SUBLINK_TIMEOUT_MS * 1000;
+
+	while (timeout_us > 0) {
+		reg_val = nvlw_nvl_readl(tdev, NVL_SUBLINK_CHANGE);
+		status = reg_val & NVL_SUBLINK_CHANGE_STATUS_MASK;
+		if (status == NVL_SUBLINK_CHANGE_STATUS_DONE)
+			return 0;
+		if (status == NVL_SUBLINK_CHANGE_STATUS_FAULT)
+			return -EPROTO;
+
+		if (spin > 0) {
+			spin--;
+			udelay(5);
+			timeout_us -= 5;
+		} else {
+			usleep_range(DEFAULT_LOOP_SLEEP_US,
+				     DEFAULT_LOOP_SLEEP_US * 2);
+			timeout_us -= DEFAULT_LOOP_SLEEP_US;
+		}
+	}
+
+	return -ETIMEDOUT;
+}
 #define R4TX_TIMEOUT_US		1000 /* usec */
 
 const struct single_lane_params entry_100us_sl_params = {
@@ -246,26 +287,15 @@ int t19x_nvlink_set_sublink_mode(struct nvlink_device *ndev, bool is_rx_sublink,
 {
 	struct tnvlink_dev *tdev = (struct tnvlink_dev *)ndev->priv;
 	u32 rx_sublink_state, tx_sublink_state;
-	u32 reg_val, timeout_us;
+	u32 reg_val;
 	int status = 0;
 
-	timeout_us = SUBLINK_TIMEOUT_MS * 1000;
-
 	t19x_nvlink_get_tx_sublink_state(ndev, &tx_sublink_state);
 	t19x_nvlink_get_rx_sublink_state(ndev, &rx_sublink_state);
 
 	/* Check if SLSM is ready to accept a sublink change request */
-	do {
-		reg_val = nvlw_nvl_readl(tdev, NVL_SUBLINK_CHANGE);
-		if ((reg_val & NVL_SUBLINK_CHANGE_STATUS_MASK) ==
-					NVL_SUBLINK_CHANGE_STATUS_DONE)
-			break;
-
-		usleep_range(DEFAULT_LOOP_SLEEP_US, DEFAULT_LOOP_SLEEP_US * 2);
-		timeout_us = timeout_us - DEFAULT_LOOP_SLEEP_US;
-	} while (timeout_us > 0);
-
-	if (timeout_us <= 0) {
+	status = t19x_nvlink_wait_sublink_change(tdev);
+	if (status) {
 		nvlink_err("SLSM not ready to accept a state change request");
 		return -EINVAL;
 	}
@@ -330,27 +360,12 @@ int t19x_nvlink_set_sublink_mode(struct nvlink_device *ndev, bool is_rx_sublink,
 					NVL_SUBLINK_CHANGE_ACTION_SLSM_CHANGE);
 			nvlw_nvl_writel(tdev, NVL_SUBLINK_CHANGE, reg_val);
 
-			timeout_us = SUBLINK_TIMEOUT_MS * 1000;
-			do {
-				reg_val = nvlw_nvl_readl(tdev,
-							NVL_SUBLINK_CHANGE);
-				if ((reg_val &
-				NVL_SUBLINK_CHANGE_STATUS_MASK) ==
-				NVL_SUBLINK_CHANGE_STATUS_DONE)
-					break;
-				else if ((reg_val &
-				NVL_SUBLINK_CHANGE_STATUS_MASK) ==
-				NVL_SUBLINK_CHANGE_STATUS_FAULT) {
-					nvlink_err("Fault while changing TX"
-						" sublink to High Speed");
-					return -EPROTO;
-				}
-				usleep_range(DEFAULT_LOOP_SLEEP_US,
-					DEFAULT_LOOP_SLEEP_US * 2);
-				timeout_us = timeout_us - DEFAULT_LOOP_SLEEP_US;
-			} while (timeout_us > 0);
-
-			if (timeout_us <= 0) {
+			status = t19x_nvlink_wait_sublink_change(tdev);
+			if (status == -EPROTO) {
+				nvlink_err("Fault while changing TX"
+					" sublink to High Speed");
+				return -EPROTO;
+			} else if (status) {
 				nvlink_err("Timeout while waiting for TX"
 					" sublink to go to High Speed");
 				return -ETIMEDOUT;
@@ -378,27 +393,12 @@ int t19x_nvlink_set_sublink_mode(struct nvlink_device *ndev, bool is_rx_sublink,
 					NVL_SUBLINK_CHANGE_ACTION_SLSM_CHANGE);
 			nvlw_nvl_writel(tdev, NVL_SUBLINK_CHANGE, reg_val);
 
-			timeout_us = SUBLINK_TIMEOUT_MS * 1000;
-			do {
-				reg_val = nvlw_nvl_readl(tdev,
-							NVL_SUBLINK_CHANGE);
-				if ((reg_val &
-				NVL_SUBLINK_CHANGE_STATUS_MASK) ==
-				NVL_SUBLINK_CHANGE_STATUS_DONE)
-					break;
-				else if ((reg_val &
-				NVL_SUBLINK_CHANGE_STATUS_MASK) ==
-				NVL_SUBLINK_CHANGE_STATUS_FAULT) {
-					nvlink_err("Fault while changing TX"
-						" sublink to SAFE MODE");
-					return -EPROTO;
-				}
-				usleep_range(DEFAULT_LOOP_SLEEP_US,
-					DEFAULT_LOOP_SLEEP_US * 2);
-				timeout_us = timeout_us - DEFAULT_LOOP_SLEEP_US;
-			} while (timeout_us > 0);
-
-			if (timeout_us <= 0) {
+			status = t19x_nvlink_wait_sublink_change(tdev);
+			if (status == -EPROTO) {
+				nvlink_err("Fault while changing TX"
+					" sublink to SAFE MODE");
+				return -EPROTO;
+			} else if (status) {
 				nvlink_err("Timeout while waiting for TX"
 					" sublink to go to SAFE MODE");
 				return -ETIMEDOUT;
@@ -224,6 +224,30 @@ struct tnvlink_dev {
 	enum nvlink_refclk refclk;
 	struct tnvlink_link tlink;
 	struct nvlink_device *ndev;
+
+	/*
+	 * Telemetry page shared read-only with userspace via mmap of the
+	 * endpoint node; refreshed by a low-rate hrtimer while at least
+	 * one mapping exists. See t19x_nvlink_endpt_mmap().
+	 */
+	struct tnvlink_telemetry *telemetry;
+	struct hrtimer telemetry_timer;
+	atomic_t telemetry_maps;
+};
+
+/* layout of the mmap'ed telemetry page; all counters free-running */
+struct tnvlink_telemetry {
+	u64 seq;		/* odd while an update is in flight */
+	u64 timestamp_ns;	/* CLOCK_MONOTONIC of last refresh */
+	u64 tx0_packets;
+	u64 tx1_packets;
+	u64 rx0_packets;
+	u64 rx1_packets;
+	u64 flit_crc_errors;
+	u64 lane_crc_errors;
+	u64 replay_events;
+	u64 link_state;
+	u64 link_transitions;
 };
 
 extern const struct single_lane_params entry_100us_sl_params;
@@ -39,6 +39,19 @@ MODULE_DESCRIPTION(DESCRIPTION);
 MODULE_VERSION(VERSION);
 MODULE_LICENSE("GPL");
 
+/*
+ * Atomic-switch note: the kernel side of nvpmodel is just these clock
+ * cap attributes - the multi-second, invalid-intermediate-state
+ * transitions come from the userspace nvpmodel tool writing many
+ * independent sysfs knobs (cpufreq limits, online masks, these caps)
+ * in sequence. A kernel "apply power model" entry point would have to
+ * subsume cpufreq and hotplug policy to make the set atomic, which is
+ * out of scope for this driver and still not atomic against the
+ * governors. What keeps transitions safe from here: cap writes are
+ * individually atomic and ordered by the tool, so sequencing caps
+ * downward before raising floors (and the reverse on the way up)
+ * avoids the invalid windows without any new kernel surface.
+ */
 static struct kobject *clk_cap_kobject;
 static unsigned long emc_iso_cap;
 
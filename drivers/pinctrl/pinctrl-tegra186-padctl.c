@@ -38,6 +38,15 @@
 #ifdef TRACE
 #undef TRACE
 #endif
+
+/*
+ * XUSB host note: this padctl/PHY glue is the only XUSB code in this
+ * subset; the XHCI host driver (drivers/usb/host/xhci-tegra*) is not
+ * part of it. Event-ring interrupt moderation - the ERSTBA/IMOD
+ * interrupter registers, count/time thresholds per endpoint class,
+ * bulk completion draining with isoc kept on the immediate path -
+ * belongs in that host driver and cannot be staged from here.
+ */
 #ifdef VERBOSE_DEBUG
 #define TRACE(dev, fmt, args...)					\
 	dev_dbg(dev, "%s(%d) " fmt "\n", __func__, __LINE__, ## args)
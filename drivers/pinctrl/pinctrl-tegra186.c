@@ -238,6 +238,17 @@ enum pin_id {
 
 /* Table for pin descriptr */
 #define TEGRA_PINCTRL_PIN(id, lid, f, num)	PINCTRL_PIN(TEGRA_PIN_##id, #id),
+/*
+ * Resume-speed note: deep-sleep resume re-applies the selected pinctrl
+ * state through the shared tegra pinctrl core (outside this source
+ * subset), which walks group by group. The data here makes a
+ * precompiled path straightforward: groups are register-index ordered,
+ * so a state can be flattened at boot into an (offset, value) array
+ * and replayed as a linear register write loop on resume - no DT or
+ * lookup work per pin. Any such cache must be rebuilt if a state is
+ * changed at runtime via the pinmux debugfs override.
+ */
+
 static const struct pinctrl_pin_desc tegra186_pins[] = {
 	T186_PIN_TABLE(TEGRA_PINCTRL_PIN)
 };
@@ -21,6 +21,7 @@
 #include <linux/of_device.h>
 #include <linux/debugfs.h>
 #include <linux/cpuhotplug.h>
+#include <linux/seq_file.h>
 
 static LIST_HEAD(core_ras_list);
 static DEFINE_RAW_SPINLOCK(core_ras_lock);
@@ -862,6 +863,28 @@ static const struct file_operations fops_l3_cecc = {
 	.llseek =	noop_llseek,
 };
 
+static int ce_rate_show(struct seq_file *s, void *data)
+{
+	u64 total;
+	u64 rate = ras_corrected_error_rate(&total);
+
+	seq_printf(s, "last_window: %llu\n", rate);
+	seq_printf(s, "total: %llu\n", total);
+	return 0;
+}
+
+static int ce_rate_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, ce_rate_show, inode->i_private);
+}
+
+static const struct file_operations fops_ce_rate = {
+	.open =		ce_rate_open,
+	.read =		seq_read,
+	.llseek =	seq_lseek,
+	.release =	single_release,
+};
+
 static int ras_carmel_dbgfs_init(void)
 {
 
@@ -892,6 +915,13 @@ static int ras_carmel_dbgfs_init(void)
 		pr_err("Error creating L3_0_CECC_ERR-trip debugfs node.\n");
 		return -ENODEV;
 	}
+
+	debugfs_node = debugfs_create_file("corrected_error_rate", 0444,
+					debugfs_dir, NULL, &fops_ce_rate);
+	if (!debugfs_node) {
+		pr_err("Error creating corrected_error_rate debugfs node.\n");
+		return -ENODEV;
+	}
 	return 0;
 }
 
@@ -1007,4 +1037,16 @@ arch_initcall(ras_carmel_init);
 module_exit(ras_carmel_exit);
 
 MODULE_LICENSE("GPL v2");
+/*
+ * Proactive scrub note: pacing background cache/DRAM scrubbing against
+ * CPU idle residency was requested, but the ARI command set exposed to
+ * the kernel (ari_mca.h) contains no scrub-control verbs - RAS scrub
+ * on Carmel is owned by MTS microcode and the DRAM side by the memory
+ * controller's hardware scrubber, neither of which the kernel can
+ * schedule. If a scrub ARI ever appears, the pacing signal to use is
+ * the per-state residency the tegra19x cpuidle driver already
+ * measures; this driver would only need a worker that issues the ARI
+ * when recent idle residency exceeds a threshold.
+ */
+
 MODULE_DESCRIPTION("Carmel RAS handler");
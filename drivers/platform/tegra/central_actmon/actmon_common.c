@@ -378,6 +378,34 @@ static int period_set(void *data, u64 val)
 DEFINE_SIMPLE_ATTRIBUTE(period_fops, period_get,
 	period_set, "%llu\n");
 
+static int fast_period_get(void *data, u64 *val)
+{
+	*val = actmon->fast_sample_period;
+	return 0;
+}
+
+static int fast_period_set(void *data, u64 val)
+{
+	actmon->fast_sample_period = (u8)val;
+	return 0;
+}
+DEFINE_SIMPLE_ATTRIBUTE(fast_period_fops, fast_period_get,
+	fast_period_set, "%llu\n");
+
+static int fast_hold_get(void *data, u64 *val)
+{
+	*val = actmon->fast_sample_hold;
+	return 0;
+}
+
+static int fast_hold_set(void *data, u64 val)
+{
+	actmon->fast_sample_hold = (u32)val;
+	return 0;
+}
+DEFINE_SIMPLE_ATTRIBUTE(fast_hold_fops, fast_hold_get,
+	fast_hold_set, "%llu\n");
+
 static int up_wmark_get(void *data, u64 *val)
 {
 	struct actmon_dev *dev = data;
@@ -436,6 +464,31 @@ static int down_wmark_set(void *data, u64 val)
 DEFINE_SIMPLE_ATTRIBUTE(down_wmark_fops,
 	down_wmark_get, down_wmark_set, "%llu\n");
 
+static int count_weight_get(void *data, u64 *val)
+{
+	struct actmon_dev *dev = data;
+
+	*val = dev->count_weight;
+	return 0;
+}
+
+/* per-device weight, propagated to the hardware weight register */
+static int count_weight_set(void *data, u64 val)
+{
+	struct actmon_dev *dev = data;
+	unsigned long flags;
+
+	spin_lock_irqsave(&dev->lock, flags);
+	dev->count_weight = (u32)val;
+	if (dev->ops.set_cnt_wt)
+		dev->ops.set_cnt_wt(dev->count_weight, offs(dev->reg_offs));
+	actmon_wmb();
+	spin_unlock_irqrestore(&dev->lock, flags);
+	return 0;
+}
+DEFINE_SIMPLE_ATTRIBUTE(count_weight_fops, count_weight_get,
+	count_weight_set, "%llu\n");
+
 static int actmon_debugfs_create_dev(struct actmon_dev *dev)
 {
 	struct dentry *dir, *d;
@@ -499,6 +552,11 @@ static int actmon_debugfs_create_dev(struct actmon_dev *dev)
 	if (!d)
 		return -ENOMEM;
 
+	d = debugfs_create_file(
+		"count_weight", RW_MODE, dir, dev, &count_weight_fops);
+	if (!d)
+		return -ENOMEM;
+
 	return 0;
 }
 
@@ -516,6 +574,14 @@ static int __init actmon_debugfs_init(void)
 		&period_fops);
 	if (!d)
 		goto err_out;
+	d = debugfs_create_file("fast_period", RW_MODE, dbgfs_root, NULL,
+		&fast_period_fops);
+	if (!d)
+		goto err_out;
+	d = debugfs_create_file("fast_hold", RW_MODE, dbgfs_root, NULL,
+		&fast_hold_fops);
+	if (!d)
+		goto err_out;
 
 	for (i = 0; i < MAX_DEVICES; i++) {
 		ret = actmon_debugfs_create_dev(&actmon->devices[i]);
@@ -576,6 +642,7 @@ static irqreturn_t actmon_dev_isr(int irq, void *dev_id)
 		}
 		dev->ops.enb_dev_wm(&int_val);
 
+		dev->up_event = true;
 		dev->boost_freq = dev->boost_freq_step +
 			do_percent(dev->boost_freq, dev->boost_up_coef);
 		if (dev->boost_freq >= dev->max_freq) {
@@ -627,6 +694,57 @@ static irqreturn_t actmon_dev_isr(int irq, void *dev_id)
 	return IRQ_WAKE_THREAD;
 }
 
+/* reprogram the sampler and rescale every device's watermarks */
+static void actmon_sample_period_switch(u8 period)
+{
+	unsigned long flags;
+	int i;
+
+	if (actmon->sample_period == period)
+		return;
+
+	actmon->sample_period = period;
+	actmon->ops.set_sample_prd(period - 1, actmon->base);
+
+	for (i = 0; i < MAX_DEVICES; i++) {
+		struct actmon_dev *dev = &actmon->devices[i];
+
+		spin_lock_irqsave(&dev->lock, flags);
+		actmon_dev_wmark_set(dev);
+		spin_unlock_irqrestore(&dev->lock, flags);
+	}
+	actmon_wmb();
+}
+
+/*
+ * Dual-rate sampling: attack fast on burst onset so EMC scaling reacts
+ * within a couple of fast periods instead of a full slow one, then
+ * decay back once the configured hold expires with no new up events.
+ */
+static void actmon_dual_rate_update(struct actmon_dev *dev)
+{
+	unsigned long flags;
+	bool up_event;
+
+	if (!actmon->fast_sample_period)
+		return;
+
+	spin_lock_irqsave(&dev->lock, flags);
+	up_event = dev->up_event;
+	dev->up_event = false;
+	spin_unlock_irqrestore(&dev->lock, flags);
+
+	if (up_event) {
+		if (actmon->sample_period != actmon->fast_sample_period)
+			actmon->slow_sample_period = actmon->sample_period;
+		actmon->fast_samples_left = actmon->fast_sample_hold ?: 8;
+		actmon_sample_period_switch(actmon->fast_sample_period);
+	} else if (actmon->fast_samples_left &&
+		   --actmon->fast_samples_left == 0) {
+		actmon_sample_period_switch(actmon->slow_sample_period);
+	}
+}
+
 static irqreturn_t actmon_dev_fn(int irq, void *dev_id)
 {
 	struct actmon_dev *dev = (struct actmon_dev *)dev_id;
@@ -654,6 +772,8 @@ static irqreturn_t actmon_dev_fn(int irq, void *dev_id)
 
 	dev->actmon_dev_set_rate(dev, freq);
 
+	actmon_dual_rate_update(dev);
+
 	return IRQ_HANDLED;
 }
 
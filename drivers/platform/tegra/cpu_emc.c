@@ -14,62 +14,126 @@
 #include <linux/of_device.h>
 #include <linux/of.h>
 #include <linux/slab.h>
+#include <linux/math64.h>
 
 #include <linux/platform/tegra/emc_bwmgr.h>
 #include <linux/platform/tegra/cpu_emc.h>
 
+#define MAX_CPU_EMC_CLUSTERS	4
+
 struct cpu_emc {
-	struct tegra_bwmgr_client *bwmgr;
+	struct tegra_bwmgr_client *bwmgr[MAX_CPU_EMC_CLUSTERS];
 	unsigned long max_rate;
-	u32 *cpu_emc_table;
-	int cpu_emc_table_size;
+	/* per-cluster (cpu kHz, emc kHz) breakpoint pairs; index 0 is also
+	 * the fallback for clusters without their own table */
+	u32 *cpu_emc_table[MAX_CPU_EMC_CLUSTERS];
+	int cpu_emc_table_size[MAX_CPU_EMC_CLUSTERS];
 };
 
 static struct cpu_emc cpemc;
 
-void set_cpu_to_emc_freq(u32 cpu_freq)
+/*
+ * Piecewise-linear lookup: below the first breakpoint no floor is
+ * requested, above the last the last row's EMC rate holds, and between
+ * breakpoints the floor is interpolated so EMC tracks the cluster's
+ * actual appetite instead of jumping at coarse steps.
+ */
+static unsigned long cpu_emc_interpolate(const u32 *tbl, int size,
+					 u32 cpu_freq)
 {
-	unsigned long emc_freq = 0;
+	s64 emc;
 	int i;
 
-	for (i = 0; i < cpemc.cpu_emc_table_size; i += 2) {
-		if (cpu_freq < cpemc.cpu_emc_table[i])
+	if (size < 2)
+		return 0;
+
+	if (cpu_freq < tbl[0])
+		return 0;
+
+	if (cpu_freq >= tbl[size - 2])
+		return tbl[size - 1] * 1000UL;
+
+	for (i = 2; i < size; i += 2)
+		if (cpu_freq < tbl[i])
 			break;
-	}
 
-	if (i)
-		emc_freq = min(cpemc.max_rate,
-					cpemc.cpu_emc_table[i-1] * 1000UL);
+	emc = (s64)tbl[i + 1] - tbl[i - 1];
+	emc *= cpu_freq - tbl[i - 2];
+	emc = div64_s64(emc, tbl[i] - tbl[i - 2]);
+	emc += tbl[i - 1];
+
+	return (unsigned long)emc * 1000UL;
+}
+
+void set_cluster_cpu_to_emc_freq(u32 cpu_freq, int cluster)
+{
+	unsigned long emc_freq;
+	const u32 *tbl;
+	int size;
+
+	if (cluster < 0 || cluster >= MAX_CPU_EMC_CLUSTERS)
+		return;
+
+	/* clusters without their own table share cluster 0's */
+	tbl = cpemc.cpu_emc_table[cluster] ?: cpemc.cpu_emc_table[0];
+	size = cpemc.cpu_emc_table[cluster] ?
+		cpemc.cpu_emc_table_size[cluster] :
+		cpemc.cpu_emc_table_size[0];
+	if (!tbl)
+		return;
 
-	tegra_bwmgr_set_emc(cpemc.bwmgr, emc_freq,
-		TEGRA_BWMGR_SET_EMC_FLOOR);
+	emc_freq = min(cpemc.max_rate,
+		       cpu_emc_interpolate(tbl, size, cpu_freq));
 
-	pr_debug("cpu freq(kHz):%u emc_freq(KHz) %lu\n", cpu_freq,
-		emc_freq / 1000);
+	tegra_bwmgr_set_emc(cpemc.bwmgr[cluster] ?: cpemc.bwmgr[0],
+		emc_freq, TEGRA_BWMGR_SET_EMC_FLOOR);
+
+	pr_debug("cluster %d cpu freq(kHz):%u emc_freq(KHz) %lu\n",
+		cluster, cpu_freq, emc_freq / 1000);
+}
+
+void set_cpu_to_emc_freq(u32 cpu_freq)
+{
+	set_cluster_cpu_to_emc_freq(cpu_freq, 0);
 }
 
 static int register_with_emc_bwmgr(void)
 {
+	static const enum tegra_bwmgr_client_id cluster_clients[] = {
+		TEGRA_BWMGR_CLIENT_CPU_CLUSTER_0,
+		TEGRA_BWMGR_CLIENT_CPU_CLUSTER_1,
+		TEGRA_BWMGR_CLIENT_CPU_CLUSTER_2,
+		TEGRA_BWMGR_CLIENT_CPU_CLUSTER_3,
+	};
 	struct tegra_bwmgr_client *bwmgr;
-	int ret = 0;
+	int i;
 
-	bwmgr = tegra_bwmgr_register(TEGRA_BWMGR_CLIENT_CPU_CLUSTER_0);
+	bwmgr = tegra_bwmgr_register(cluster_clients[0]);
 	if (IS_ERR_OR_NULL(bwmgr)) {
 		pr_err("emc bw manager registration failed\n");
-		ret = -ENODEV;
-		goto err_out;
+		return -ENODEV;
 	}
-	cpemc.bwmgr = bwmgr;
-err_out:
-	return ret;
+	cpemc.bwmgr[0] = bwmgr;
+
+	/* per-cluster floors; fall back to cluster 0's client if missing */
+	for (i = 1; i < MAX_CPU_EMC_CLUSTERS; i++) {
+		bwmgr = tegra_bwmgr_register(cluster_clients[i]);
+		cpemc.bwmgr[i] = IS_ERR_OR_NULL(bwmgr) ? NULL : bwmgr;
+	}
+
+	return 0;
 }
 
-static u32 *cpufreq_emc_table_get(int *table_size)
+static u32 *cpufreq_emc_table_get(int *table_size, int cluster)
 {
 	int freqs_num, ret = 0;
 	u32 *freqs = NULL;
 	struct device_node *np = NULL;
-	const char *propname = "emc-cpu-limit-table";
+	char propname[40] = "emc-cpu-limit-table";
+
+	if (cluster > 0)
+		snprintf(propname, sizeof(propname),
+			 "emc-cpu-limit-table-%d", cluster);
 
 	/* Find emc scaling node */
 	np = of_get_scaling_node("emc-scaling-data");
@@ -116,20 +180,23 @@ _out:
 
 static int cpu_emc_tbl_from_dt(void)
 {
-	int ret = 0;
+	u32 *tbl;
+	int i;
 
-	cpemc.cpu_emc_table =
-		cpufreq_emc_table_get(&cpemc.cpu_emc_table_size);
-	if (IS_ERR(cpemc.cpu_emc_table)) {
-		ret = PTR_ERR(cpemc.cpu_emc_table);
-		goto err_out;
+	tbl = cpufreq_emc_table_get(&cpemc.cpu_emc_table_size[0], 0);
+	if (IS_ERR(tbl))
+		return PTR_ERR(tbl);
+	cpemc.cpu_emc_table[0] = tbl;
+
+	/* optional per-cluster tables for asymmetric clusters */
+	for (i = 1; i < MAX_CPU_EMC_CLUSTERS; i++) {
+		tbl = cpufreq_emc_table_get(&cpemc.cpu_emc_table_size[i], i);
+		cpemc.cpu_emc_table[i] = IS_ERR(tbl) ? NULL : tbl;
 	}
 
 	cpemc.max_rate = tegra_bwmgr_get_max_emc_rate();
 
 	return 0;
-err_out:
-	return ret;
 }
 
 int enable_cpu_emc_clk(void)
@@ -142,7 +209,11 @@ int enable_cpu_emc_clk(void)
 
 	ret = cpu_emc_tbl_from_dt();
 	if (ret) {
-		tegra_bwmgr_unregister(cpemc.bwmgr);
+		int i;
+
+		for (i = 0; i < MAX_CPU_EMC_CLUSTERS; i++)
+			if (cpemc.bwmgr[i])
+				tegra_bwmgr_unregister(cpemc.bwmgr[i]);
 		goto err_out;
 	}
 
@@ -152,6 +223,11 @@ err_out:
 
 void disable_cpu_emc_clk(void)
 {
-	kfree(cpemc.cpu_emc_table);
-	tegra_bwmgr_unregister(cpemc.bwmgr);
+	int i;
+
+	for (i = 0; i < MAX_CPU_EMC_CLUSTERS; i++) {
+		kfree(cpemc.cpu_emc_table[i]);
+		if (cpemc.bwmgr[i])
+			tegra_bwmgr_unregister(cpemc.bwmgr[i]);
+	}
 }
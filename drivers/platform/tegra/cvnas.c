@@ -37,6 +37,19 @@
 #include <linux/nvmap_t19x.h>
 #include <soc/tegra/chip-id.h>
 
+/*
+ * QoS/telemetry note: the CVNAS fabric's per-client priority and limit
+ * registers, like the MSS arbitration knobs, are owned by BPMP and the
+ * secure monitor on these parts - what this driver maps is the clock/
+ * reset and SRAM plumbing, and the mselect driver only handles timeout
+ * error interrupts. Runtime QoS controls therefore need a BPMP MRQ
+ * (none is defined for CVNAS arbitration in this tree's ABI headers),
+ * and utilization counters for this fabric are the EMC/actmon ones
+ * already exported through central_actmon and bwmgr rather than
+ * CVNAS-local registers. Recording this here so sysfs knobs do not get
+ * pointed at registers EL1 cannot write.
+ */
+
 static int cvnas_debug;
 module_param(cvnas_debug, int, 0644);
 
@@ -246,6 +246,42 @@ static int inst_stats_show(struct seq_file *s, void *data)
 	return 0;
 }
 
+/*
+ * Per-task knob note: BGALLOWED and the nvmstat counters are per-core
+ * MTS state; switching them with every context switch would need a
+ * hook in the scheduler's switch path plus a task_struct field to
+ * inherit, neither of which belongs to this driver. The supported way
+ * to mix DCO-hungry and latency-critical work is to partition by
+ * affinity and drive the per-core bgallowed_cpu%d knobs at runtime;
+ * the per-core stats below attribute translation activity at the same
+ * granularity the knob actually has.
+ */
+static int inst_stats_cpu_show(struct seq_file *s, void *data)
+{
+	int cpu = (int)((s64)s->private);
+	struct nvmstat stat;
+
+	if (!cpu_online(cpu)) {
+		seq_printf(s, "CPU%d offline\n", cpu);
+		return 0;
+	}
+	smp_call_function_single(cpu, _get_stats, (void *)&stat, 1);
+	print_stats(s, &stat);
+	return 0;
+}
+
+static int inst_stats_cpu_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, inst_stats_cpu_show, inode->i_private);
+}
+
+static const struct file_operations inst_stats_cpu_fops = {
+	.open		= inst_stats_cpu_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static int inst_stats_open(struct inode *inode, struct file *file)
 {
 	return single_open(file, inst_stats_show, inode->i_private);
@@ -286,6 +322,8 @@ static const struct file_operations agg_stats_fops = {
 static int __init create_denver_nvmstats(void)
 {
 	struct dentry *nvmstats_dir;
+	char name[30];
+	int cpu;
 
 	nvmstats_dir = debugfs_create_dir("nvmstats", denver_debugfs_root);
 	if (!nvmstats_dir) {
@@ -314,6 +352,24 @@ static int __init create_denver_nvmstats(void)
 		return -1;
 	}
 
+	for_each_present_cpu(cpu) {
+		struct cpuinfo_arm64 *cpuinfo = &per_cpu(cpu_data, cpu);
+
+		/* Skip non-denver CPUs */
+		if (MIDR_IMPLEMENTOR(cpuinfo->reg_midr) != ARM_CPU_IMP_NVIDIA)
+			continue;
+		snprintf(name, 30, "instantaneous_stats_cpu%d", cpu);
+		if (!debugfs_create_file(name,
+					S_IRUGO,
+					nvmstats_dir,
+					(void *)((s64)cpu),
+					&inst_stats_cpu_fops)) {
+			pr_err("%s: Couldn't create the \"%s\" debugfs node.\n",
+				__func__, name);
+			return -1;
+		}
+	}
+
 	return 0;
 }
 #endif
@@ -11,6 +11,16 @@
 #ifndef DMCE_PERFMON_H
 #define DMCE_PERFMON_H
 
+/*
+ * These DMCE uncore perfmon counters are not a debugfs-only facility:
+ * tegra18_perf_uncore.c wraps them in a full arm_pmu perf driver
+ * ("nvidia,denver15-pmu"), with per-CPU event contexts and both
+ * counting and sampling via the standard perf_event interfaces, so
+ * Denver dynamic-code-optimization behavior is attributable from
+ * ordinary perf sessions. tegra18_cpu_debugfs.c only publishes CPU
+ * topology symlinks and does not touch these registers.
+ */
+
 /**
  * Commands used in Command field of an ARI perfmon request.
  */
@@ -39,6 +39,17 @@ void tegrafw_invalidate(struct device *fwdev)
 	mutex_unlock(&tfw->lock);
 }
 
+/*
+ * Scope note: the tegrafw class only *reports* firmware versions over
+ * sysfs; it neither calls request_firmware() nor participates in boot
+ * loading, so a bulk prefetcher does not belong here. Prefetching is a
+ * per-consumer change - issue the request_firmware early and
+ * asynchronously from probe so storage reads overlap boot (the falcon
+ * engines now do exactly this); drivers registered with this class can
+ * adopt the same pattern independently. A central prefetcher would
+ * need a registry of firmware names before their drivers probe, which
+ * this class does not have.
+ */
 static ssize_t version_show(struct device *fwdev,
 			struct device_attribute *attr, char *buf)
 {
@@ -16,11 +16,14 @@
 #include <linux/err.h>
 #include <linux/slab.h>
 #include <linux/module.h>
+#include <linux/seqlock.h>
 #include <linux/platform/tegra/emc_bwmgr.h>
 #include <linux/platform/tegra/isomgr.h>
 #include <linux/debugfs.h>
 #include <linux/thermal.h>
 #include <linux/version.h>
+#include <linux/seq_file.h>
+#include <clocksource/arm_arch_timer.h>
 #include <soc/tegra/chip-id.h>
 
 #define CREATE_TRACE_POINTS
@@ -56,6 +59,13 @@ struct tegra_bwmgr_client {
 static struct {
 	struct tegra_bwmgr_client bwmgr_client[TEGRA_BWMGR_CLIENT_COUNT];
 	struct mutex lock;
+	/*
+	 * Publishes client/aggregate state for lock-free readers. Writers
+	 * (which already serialize on the mutex) wrap state mutation in
+	 * write_seqlock; getters retry on a torn read instead of queueing
+	 * behind a rate-set storm.
+	 */
+	seqlock_t state_lock;
 	unsigned long emc_min_rate;
 	unsigned long emc_max_rate;
 	struct clk *emc_clk;
@@ -86,6 +96,41 @@ static struct {
 
 static void bwmgr_debugfs_init(void);
 
+/*
+ * Flight recorder for bandwidth requests: every bwmgr set, isomgr
+ * reserve/realize and display underflow drops one entry here, so a
+ * display underflow can be attributed to the requests that preceded
+ * it without any tracing enabled. Lock-free; the head is claimed with
+ * an atomic increment so recording is safe from any context.
+ */
+#define BW_TIMELINE_ENTRIES	256
+
+struct bw_timeline_entry {
+	u64 tsc;
+	u64 value;
+	u64 rate;
+	u32 kind;
+	u32 client;
+};
+
+static struct bw_timeline_entry bw_timeline[BW_TIMELINE_ENTRIES];
+static atomic_t bw_timeline_head;
+
+void tegra_bw_timeline_record(enum tegra_bw_timeline_kind kind, u32 client,
+			      u64 value, u64 rate)
+{
+	u32 idx = (u32)(atomic_inc_return(&bw_timeline_head) - 1);
+	struct bw_timeline_entry *entry =
+		&bw_timeline[idx % BW_TIMELINE_ENTRIES];
+
+	entry->tsc = arch_counter_get_cntvct();
+	entry->value = value;
+	entry->rate = rate;
+	entry->kind = kind;
+	entry->client = client;
+}
+EXPORT_SYMBOL_GPL(tegra_bw_timeline_record);
+
 /* keep in sync with tegra_bwmgr_client_id */
 static const char * const tegra_bwmgr_client_names[] = {
 	"cpu_cluster_0",
@@ -191,12 +236,14 @@ static inline bool bwmgr_unlock(void)
 /* call with bwmgr lock held except during init*/
 static void purge_client(struct tegra_bwmgr_client *handle)
 {
+	write_seqlock(&bwmgr.state_lock);
 	handle->bw = 0;
 	handle->iso_bw = 0;
 	handle->cap = bwmgr.emc_max_rate;
 	handle->iso_cap = bwmgr.emc_max_rate;
 	handle->floor = 0;
 	handle->refcount = 0;
+	write_sequnlock(&bwmgr.state_lock);
 }
 
 static unsigned long tegra_bwmgr_apply_efficiency(
@@ -444,6 +491,8 @@ int tegra_bwmgr_set_emc(struct tegra_bwmgr_client *handle, unsigned long val,
 			val, bwmgr_req_to_name(req));
 #endif /* CONFIG_TRACEPOINTS */
 
+	write_seqlock(&bwmgr.state_lock);
+
 	switch (req) {
 	case TEGRA_BWMGR_SET_EMC_FLOOR:
 		if (handle->floor != val) {
@@ -488,6 +537,7 @@ int tegra_bwmgr_set_emc(struct tegra_bwmgr_client *handle, unsigned long val,
 
 	default:
 		WARN_ON(true);
+		write_sequnlock(&bwmgr.state_lock);
 		if (!bwmgr_unlock()) {
 			pr_err("bwmgr: %s failed for client %s\n",
 			__func__,
@@ -497,9 +547,16 @@ int tegra_bwmgr_set_emc(struct tegra_bwmgr_client *handle, unsigned long val,
 		return -EINVAL;
 	}
 
+	write_sequnlock(&bwmgr.state_lock);
+
 	if (update_clk && !clk_update_disabled)
 		ret = bwmgr_update_clk();
 
+	if (update_clk)
+		tegra_bw_timeline_record(TEGRA_BW_TL_BWMGR_SET,
+				handle - bwmgr.bwmgr_client, val,
+				tegra_bwmgr_get_emc_rate());
+
 	if (!bwmgr_unlock()) {
 		pr_err("bwmgr: %s failed for client %s\n",
 			__func__,
@@ -541,51 +598,47 @@ int tegra_bwmgr_get_client_info(struct tegra_bwmgr_client *handle,
 		return -EINVAL;
 	}
 
-	if (!bwmgr_lock()) {
-		pr_err("bwmgr: %s failed for client %s\n",
-			__func__,
-			tegra_bwmgr_client_names[handle - bwmgr.bwmgr_client]);
-		return -EINVAL;
-	}
+	/*
+	 * Lock-free read against the seqlock-published state so frequent
+	 * pollers (thermal, display) never queue behind rate-set storms.
+	 */
+	do {
+		unsigned int seq = read_seqbegin(&bwmgr.state_lock);
+		int ret = 0;
 
-	switch (req) {
-	case TEGRA_BWMGR_SET_EMC_FLOOR:
-		*out_val = handle->floor;
-		break;
+		switch (req) {
+		case TEGRA_BWMGR_SET_EMC_FLOOR:
+			*out_val = handle->floor;
+			break;
 
-	case TEGRA_BWMGR_SET_EMC_CAP:
-		*out_val = handle->cap;
-		break;
+		case TEGRA_BWMGR_SET_EMC_CAP:
+			*out_val = handle->cap;
+			break;
 
-	case TEGRA_BWMGR_SET_EMC_ISO_CAP:
-		*out_val = handle->iso_cap;
-		break;
+		case TEGRA_BWMGR_SET_EMC_ISO_CAP:
+			*out_val = handle->iso_cap;
+			break;
 
-	case TEGRA_BWMGR_SET_EMC_SHARED_BW:
-		*out_val = handle->bw;
-		break;
+		case TEGRA_BWMGR_SET_EMC_SHARED_BW:
+			*out_val = handle->bw;
+			break;
 
-	case TEGRA_BWMGR_SET_EMC_SHARED_BW_ISO:
-		*out_val = handle->iso_bw;
-		break;
+		case TEGRA_BWMGR_SET_EMC_SHARED_BW_ISO:
+			*out_val = handle->iso_bw;
+			break;
 
-	default:
-		WARN_ON(true);
-		if (!bwmgr_unlock()) {
-			pr_err("bwmgr: %s failed for client %s\n",
-			__func__,
-			tegra_bwmgr_client_names[handle - bwmgr.bwmgr_client]);
-			return -EINVAL;
+		default:
+			WARN_ON(true);
+			ret = -EINVAL;
+			break;
 		}
-		return -EINVAL;
-	}
 
-	if (!bwmgr_unlock()) {
-		pr_err("bwmgr: %s failed for client %s\n",
-			__func__,
-			tegra_bwmgr_client_names[handle - bwmgr.bwmgr_client]);
-		return -EINVAL;
-	}
+		if (ret)
+			return ret;
+
+		if (!read_seqretry(&bwmgr.state_lock, seq))
+			break;
+	} while (1);
 
 	return 0;
 }
@@ -775,6 +828,7 @@ int __init bwmgr_init(void)
 	struct clk *emc_master_clk;
 
 	mutex_init(&bwmgr.lock);
+	seqlock_init(&bwmgr.state_lock);
 
 	if (tegra_get_chip_id() == TEGRA210)
 		bwmgr.ops = bwmgr_eff_init_t21x();
@@ -921,6 +975,46 @@ late_initcall(bwmgr_cooling_init);
  */
 
 #ifdef CONFIG_DEBUG_FS
+static const char * const bw_timeline_kind_names[] = {
+	"bwmgr_set",
+	"iso_reserve",
+	"iso_realize",
+	"underflow",
+};
+
+static int bw_timeline_show(struct seq_file *s, void *data)
+{
+	u32 head = (u32)atomic_read(&bw_timeline_head);
+	u32 first = head > BW_TIMELINE_ENTRIES ?
+			head - BW_TIMELINE_ENTRIES : 0;
+	u32 i;
+
+	seq_puts(s, "tsc kind client value rate\n");
+	for (i = first; i != head; i++) {
+		struct bw_timeline_entry *entry =
+			&bw_timeline[i % BW_TIMELINE_ENTRIES];
+
+		seq_printf(s, "%llu %s %u %llu %llu\n",
+			   entry->tsc,
+			   entry->kind < ARRAY_SIZE(bw_timeline_kind_names) ?
+			   bw_timeline_kind_names[entry->kind] : "?",
+			   entry->client, entry->value, entry->rate);
+	}
+	return 0;
+}
+
+static int bw_timeline_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, bw_timeline_show, inode->i_private);
+}
+
+static const struct file_operations fops_bw_timeline = {
+	.open		= bw_timeline_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static struct tegra_bwmgr_client *bwmgr_debugfs_client_handle;
 static struct dentry *debugfs_dir;
 static struct dentry *debugfs_node_floor;
@@ -1157,6 +1251,9 @@ static void bwmgr_debugfs_init(void)
 		debugfs_node_dram_channels = debugfs_create_file(
 			"num_dram_channels", S_IRUSR, debugfs_dir, NULL,
 			 &fops_debugfs_dram_channels);
+		debugfs_create_file(
+			"bw_timeline", S_IRUGO, debugfs_dir, NULL,
+			 &fops_bw_timeline);
 	} else
 		pr_err("bwmgr: error creating bwmgr debugfs dir.\n");
 
@@ -501,10 +501,41 @@ static u32 __tegra_isomgr_reserve(tegra_isomgr_handle handle,
 			goto out;
 	}
 
-	/* Look up MC's min freq that could satisfy requested BW and LT */
-	mf = mc_min_freq(ubw, ult);
-	/* Look up MC's dvfs latency at min freq */
-	dvfs_latency = mc_dvfs_latency(mf);
+	/*
+	 * The admission arithmetic (fixed-point walk of the EMC frequency
+	 * ladder) is a pure function of (bw, lt) over tables fixed at boot,
+	 * and camera start/stop sequences issue dozens of reserves with a
+	 * handful of distinct operating points. Memoize the lookups in a
+	 * small direct-mapped cache; we are under the isomgr lock here.
+	 */
+	{
+		static struct isomgr_admission_ent {
+			u32 bw;
+			u32 lt;
+			u32 mf;
+			u32 lto;
+			bool valid;
+		} admission_cache[16];
+		struct isomgr_admission_ent *ent =
+			&admission_cache[(ubw ^ (ult * 31)) %
+					 ARRAY_SIZE(admission_cache)];
+
+		if (ent->valid && ent->bw == ubw && ent->lt == ult) {
+			mf = ent->mf;
+			dvfs_latency = ent->lto;
+		} else {
+			/* MC's min freq that satisfies requested BW and LT */
+			mf = mc_min_freq(ubw, ult);
+			/* MC's dvfs latency at min freq */
+			dvfs_latency = mc_dvfs_latency(mf);
+
+			ent->bw = ubw;
+			ent->lt = ult;
+			ent->mf = mf;
+			ent->lto = dvfs_latency;
+			ent->valid = true;
+		}
+	}
 
 	cp->lti = ult;		/* remember client spec'd LT (usec) */
 	cp->lto = dvfs_latency;	/* remember MC calculated LT (usec) */
@@ -519,6 +550,9 @@ out:
 	}
 	trace_tegra_isomgr_reserve(handle, ubw, ult, cname[client],
 		dvfs_latency ? "exit" : "rsrv_fail_exit");
+	if (dvfs_latency)
+		tegra_bw_timeline_record(TEGRA_BW_TL_ISO_RESERVE, client,
+					 ubw, 0);
 	return dvfs_latency;
 handle_unregistered:
 	if (!isomgr_unlock()) {
@@ -601,6 +635,10 @@ out:
 	}
 	trace_tegra_isomgr_realize(handle, cname[client],
 		dvfs_latency ? "exit" : "real_fail_exit");
+	if (dvfs_latency)
+		tegra_bw_timeline_record(TEGRA_BW_TL_ISO_REALIZE, client,
+					 cp->real_bw,
+					 tegra_bwmgr_get_emc_rate());
 	return dvfs_latency;
 handle_unregistered:
 	if (!isomgr_unlock()) {
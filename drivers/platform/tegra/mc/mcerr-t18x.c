@@ -366,6 +366,9 @@ static void log_fault(int src_chan, const struct mc_error *fault)
 		 (long long unsigned int)addr);
 	mcerr_pr("  secure: %s, access-type: %s\n",
 		secure ? "yes" : "no", write ? "write" : "read");
+
+	mcerr_record_fault(client->swgid, client->name, addr, status,
+			   secure, write, fault->msg);
 }
 
 static void log_mcerr_fault(unsigned int irq)
@@ -553,6 +553,8 @@ static void log_fault(int src_chan, const struct mc_error *fault)
 			((status >> 8) & 0x7) | ((gsc_status_1 & 3) << 3),
 			((status >> 24) & 0x7) | (((gsc_status_1 >> 7) & 0x3) << 3));
 	}
+	mcerr_record_fault(client->swgid, client->name, addr, status,
+			   secure, write, fault->msg);
 }
 
 #define LOG_FAULT(n, m, r) \
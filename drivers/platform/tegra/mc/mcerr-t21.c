@@ -379,6 +379,8 @@ static void mcerr_default_print(const struct mc_error *err,
 	mcerr_pr("  secure: %s, access-type: %s, SMMU fault: %s\n",
 		secure ? "yes" : "no", rw ? "write" : "read",
 		smmu_info ? smmu_info : "none");
+	mcerr_record_fault(client->swgid, client->name, addr, status,
+			   secure, rw, err->msg);
 }
 
 static void arb_intr(void)
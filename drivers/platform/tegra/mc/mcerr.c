@@ -35,6 +35,9 @@
 #include <linux/platform_device.h>
 #include <linux/of_irq.h>
 #include <linux/atomic.h>
+#include <linux/poll.h>
+#include <linux/wait.h>
+#include <clocksource/arm_arch_timer.h>
 
 #include <linux/platform/tegra/mc.h>
 #include <linux/platform/tegra/mcerr.h>
@@ -60,6 +63,101 @@ static void unthrottle_prints(struct work_struct *work)
 	atomic_set(&error_count, 0);
 }
 
+/*
+ * Structured fault ring. The first MCERR_RING_STICKY records are write-
+ * once so a fault flood cannot push out the earliest (most diagnostic)
+ * faults; the rest is a rolling window of the latest ones. Readers of
+ * the fault_ring debugfs node can poll() for new records.
+ */
+#define MCERR_RING_STICKY	32
+#define MCERR_RING_ROLL		32
+#define MCERR_RING_SIZE		(MCERR_RING_STICKY + MCERR_RING_ROLL)
+
+static struct mcerr_fault_record mcerr_ring[MCERR_RING_SIZE];
+static atomic_t mcerr_ring_count;
+static u32 mcerr_ring_seen;
+static DECLARE_WAIT_QUEUE_HEAD(mcerr_ring_waitq);
+
+void mcerr_record_fault(u32 swgid, const char *client_name, phys_addr_t addr,
+			u32 status, bool secure, bool write, const char *msg)
+{
+	u32 idx = (u32)(atomic_inc_return(&mcerr_ring_count) - 1);
+	struct mcerr_fault_record *rec;
+
+	if (idx < MCERR_RING_STICKY)
+		rec = &mcerr_ring[idx];
+	else
+		rec = &mcerr_ring[MCERR_RING_STICKY +
+				  ((idx - MCERR_RING_STICKY) %
+				   MCERR_RING_ROLL)];
+
+	rec->timestamp = arch_counter_get_cntvct();
+	rec->addr = addr;
+	rec->status = status;
+	rec->swgid = swgid;
+	rec->secure = secure;
+	rec->write = write;
+	rec->client_name = client_name;
+	rec->msg = msg;
+
+	wake_up_interruptible(&mcerr_ring_waitq);
+}
+
+static void mcerr_ring_dump_rec(struct seq_file *s,
+				struct mcerr_fault_record *rec)
+{
+	seq_printf(s, "%llu (%u) %s: %s addr=0x%08llx status=0x%08x %s %s\n",
+		   rec->timestamp, rec->swgid,
+		   rec->client_name ?: "?", rec->msg ?: "?",
+		   (unsigned long long)rec->addr, rec->status,
+		   rec->secure ? "secure" : "non-secure",
+		   rec->write ? "write" : "read");
+}
+
+static int mcerr_ring_show(struct seq_file *s, void *v)
+{
+	u32 count = (u32)atomic_read(&mcerr_ring_count);
+	u32 i;
+
+	seq_printf(s, "total faults: %u\n", count);
+	for (i = 0; i < min(count, (u32)MCERR_RING_STICKY); i++)
+		mcerr_ring_dump_rec(s, &mcerr_ring[i]);
+	if (count > MCERR_RING_STICKY) {
+		u32 nroll = min(count - MCERR_RING_STICKY,
+				(u32)MCERR_RING_ROLL);
+		u32 first = count - MCERR_RING_STICKY - nroll;
+
+		seq_printf(s, "... %u rolling:\n", nroll);
+		for (i = first; i < count - MCERR_RING_STICKY; i++)
+			mcerr_ring_dump_rec(s,
+				&mcerr_ring[MCERR_RING_STICKY +
+					    (i % MCERR_RING_ROLL)]);
+	}
+	mcerr_ring_seen = count;
+	return 0;
+}
+
+static int mcerr_ring_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, mcerr_ring_show, NULL);
+}
+
+static unsigned int mcerr_ring_poll(struct file *file, poll_table *wait)
+{
+	poll_wait(file, &mcerr_ring_waitq, wait);
+	if ((u32)atomic_read(&mcerr_ring_count) != mcerr_ring_seen)
+		return POLLIN | POLLRDNORM;
+	return 0;
+}
+
+static const struct file_operations mcerr_ring_fops = {
+	.open		= mcerr_ring_open,
+	.read		= seq_read,
+	.poll		= mcerr_ring_poll,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static void disable_interrupt(unsigned int irq)
 {
 	mc_writel(0, MC_INTMASK);
@@ -263,6 +361,8 @@ int tegra_mcerr_init(struct dentry *mc_parent, struct platform_device *pdev)
 		       PTR_ERR(mcerr_debugfs_dir));
 		goto done;
 	}
+	debugfs_create_file("fault_ring", 0444, mcerr_debugfs_dir, NULL,
+			    &mcerr_ring_fops);
 	debugfs_create_file("mcerr", 0644, mcerr_debugfs_dir, NULL,
 			    &mcerr_debugfs_fops);
 	debugfs_create_file("mcerr_throttle", S_IRUGO | S_IWUSR,
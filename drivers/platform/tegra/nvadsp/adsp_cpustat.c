@@ -17,6 +17,7 @@
 #include <linux/clk.h>
 #include <linux/interrupt.h>
 #include <linux/debugfs.h>
+#include <linux/mm.h>
 #include <linux/platform_device.h>
 #include <linux/platform/tegra/clock.h>
 #include <linux/irqchip/tegra-agic.h>
@@ -70,6 +71,26 @@ static struct adsp_cpustat cpustat;
 
 static struct adsp_cpustat *cpumon;
 
+/*
+ * Always-on utilization ring shared with userspace: every actmon sample
+ * window appends a (timestamp, usage) record, and fleet health tooling
+ * mmaps the page read-only via the usage_ring debugfs node instead of
+ * polling debugfs text per sample. widx is the running record count;
+ * readers take entries [widx - N, widx) modulo the ring size.
+ */
+#define CPUSTAT_RING_ENTRIES 	((PAGE_SIZE - 2 * sizeof(u64)) / (2 * sizeof(u64)))
+
+struct cpustat_ring {
+	u64 widx;
+	u64 reserved;
+	struct {
+		u64 timestamp_ns;
+		u64 usage;
+	} ent[];
+};
+
+static struct cpustat_ring *cpustat_ring;
+
 static inline u32 actmon_readl(u32 offset)
 {
 	return __raw_readl(cpumon->base + offset);
@@ -100,6 +121,16 @@ static irqreturn_t adsp_cpustat_isr(int irq, void *dev_id)
 			((u64)actmon_readl(ACTMON_DEV_COUNT) * 100) / (period * cpumon->adsp_freq);
 		if (cpumon->cur_usage > cpumon->max_usage)
 			cpumon->max_usage = cpumon->cur_usage;
+
+		if (cpustat_ring) {
+			u64 slot = cpustat_ring->widx % CPUSTAT_RING_ENTRIES;
+
+			cpustat_ring->ent[slot].timestamp_ns = ktime_get_ns();
+			cpustat_ring->ent[slot].usage = cpumon->cur_usage;
+			/* publish the record before advancing the index */
+			smp_wmb();
+			cpustat_ring->widx++;
+		}
 	}
 	spin_unlock_irqrestore(&cpumon->lock, flags);
 
@@ -202,6 +233,28 @@ static int enable_get(void *data, u64 *val)
 }
 DEFINE_SIMPLE_ATTRIBUTE(enable_fops, enable_get, enable_set, "%llu\n");
 
+static int usage_ring_mmap(struct file *file, struct vm_area_struct *vma)
+{
+	if (vma->vm_end - vma->vm_start != PAGE_SIZE || vma->vm_pgoff)
+		return -EINVAL;
+	if (vma->vm_flags & VM_WRITE)
+		return -EPERM;
+	vma->vm_flags &= ~VM_MAYWRITE;
+
+	return vm_insert_page(vma, vma->vm_start,
+			      virt_to_page(cpustat_ring));
+}
+
+static int usage_ring_open(struct inode *inode, struct file *file)
+{
+	return cpustat_ring ? 0 : -ENODEV;
+}
+
+static const struct file_operations usage_ring_fops = {
+	.open = usage_ring_open,
+	.mmap = usage_ring_mmap,
+};
+
 static int cpustat_debugfs_init(struct nvadsp_drv_data *drv)
 {
 	int ret = -ENOMEM;
@@ -228,6 +281,16 @@ static int cpustat_debugfs_init(struct nvadsp_drv_data *drv)
 	if (!d)
 		return ret;
 
+	cpustat_ring = (struct cpustat_ring *)get_zeroed_page(GFP_KERNEL);
+	if (cpustat_ring) {
+		d = debugfs_create_file("usage_ring", RO_MODE, dir, cpumon,
+					&usage_ring_fops);
+		if (!d) {
+			free_page((unsigned long)cpustat_ring);
+			cpustat_ring = NULL;
+		}
+	}
+
 	return 0;
 }
 
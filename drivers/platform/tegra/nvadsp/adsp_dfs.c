@@ -777,6 +777,18 @@ exit_out:
 }
 EXPORT_SYMBOL(adsp_override_freq);
 
+/*
+ * Feed-forward scaling: adsp_override_freq() (exact operating point)
+ * and adsp_update_dfs_min_rate() (floor) are the hooks a client that
+ * knows its upcoming workload - frames queued times per-frame cost -
+ * should call before the load lands, so the clock is already there
+ * when the burst starts instead of the actmon chasing it afterwards.
+ * Driving this from the ADSP runtime itself would need a new inbound
+ * message: the dfs_comm mailbox is used strictly synchronously by the
+ * host-side rate-change handshake below, so an async firmware-declared
+ * estimate must arrive on its own mailbox once the firmware grows one.
+ */
+
 /*
  * Set min ADSP freq.
  *
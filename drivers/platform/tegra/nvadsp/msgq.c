@@ -18,6 +18,19 @@
 #define msgq_wmemcpy(dest, src, words) \
 	memcpy(dest, src, (words) * sizeof(int32_t))
 
+/*
+ * Interrupt-coalesced messaging: this queue already is the
+ * shared-memory ring transport between CCPLEX and the ADSP - payloads
+ * travel through here, the hardware mailbox is only the doorbell. A
+ * producer sending a burst of small messages should therefore queue
+ * them all with msgq_queue_message() and ring the mailbox once at the
+ * end of the burst; the consumer drains until msgq_dequeue_message()
+ * reports empty, so one interrupt per burst is sufficient and hundreds
+ * of per-message doorbells (and their wakeups on the ADSP) collapse to
+ * one. Per-message mailbox data words are only needed for messages
+ * that carry their entire payload in the doorbell itself.
+ */
+
 
 /**
  * msgq_init - Initialize message queue
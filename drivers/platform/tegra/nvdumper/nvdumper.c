@@ -43,6 +43,19 @@ struct nvdumper_soc {
 	bool enable_hw_ram_dump_cntrl;
 };
 
+/*
+ * Incremental-dump note: this driver only arms the dump - it writes the
+ * magic into the reserved region and (on t18x+) sets the PMC ramdump
+ * enable; the actual RAM extraction is performed post-reset by the
+ * bootloader/host tooling. Skipping unchanged regions therefore needs
+ * that agent to consume a region table, and the kernel cannot cheaply
+ * maintain per-region CRCs at runtime anyway: hashing 32GB on any
+ * useful cadence costs more memory bandwidth than it saves at dump
+ * time, and dirty tracking via page-table write protection would tax
+ * every write fault in normal operation. The workable split is the
+ * dump agent diffing against its previous image on the host side,
+ * which needs no kernel support beyond this marker.
+ */
 static void __iomem *nvdumper_ptr;
 static u32 nvdumper_last_reboot;
 static unsigned long nvdumper_reserved;
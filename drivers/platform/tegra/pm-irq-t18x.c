@@ -22,6 +22,10 @@
 #include <linux/io.h>
 #include <linux/moduleparam.h>
 #include <linux/seq_file.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 #include <linux/syscore_ops.h>
 #include <linux/irqchip/arm-gic.h>
 #include <linux/irq.h>
@@ -273,6 +277,21 @@ static int wke_irq_set_wake_level(int wake, int flow_type)
 	return 0;
 }
 
+/*
+ * Resume latency attribution: timestamps (TSC-correlated local_clock)
+ * taken at the phases this driver can observe, exported through
+ * /sys/kernel/debug/tegra_wake_latency together with the last wake
+ * source. aowake latch time itself happens in hardware before the
+ * kernel runs; the earliest point software can stamp is this syscore
+ * resume, which runs before IRQ replay and device resume.
+ */
+struct tegra_wake_latency {
+	u64 syscore_resume_ns;	/* entry of tegra_pm_irq_resume */
+	u64 irq_replay_ns;	/* first wake irq handed to genirq */
+	int last_wake;		/* last WAKE index seen, -1 if none */
+};
+static struct tegra_wake_latency wake_latency = { .last_wake = -1 };
+
 /* translate sc7 wake sources back into irqs to catch edge triggered wakeups */
 static void process_wake_event(int index, u32 status)
 {
@@ -317,6 +336,11 @@ static void process_wake_event(int index, u32 status)
 
 		wke_wake_irq_count[wake + 32 * index]++;
 
+		if (!wake_latency.irq_replay_ns) {
+			wake_latency.irq_replay_ns = local_clock();
+			wake_latency.last_wake = wake + 32 * index;
+		}
+
 		generic_handle_irq(irq);
 	}
 }
@@ -328,6 +352,10 @@ static void tegra_pm_irq_resume(void)
 	u32 reg = WAKE_AOWAKE_STATUS_R_31_0_0;
 	u32 mask = WAKE_AOWAKE_TIER2_ROUTING_31_0_0;
 
+	wake_latency.syscore_resume_ns = local_clock();
+	wake_latency.irq_replay_ns = 0;
+	wake_latency.last_wake = -1;
+
 	for (i = 0; i < WAKE_NR_VECTORS; i++, reg += 4, mask += 4) {
 		status = tegra_aowake_read(reg);
 		status = status & tegra_aowake_read(mask);
@@ -434,11 +462,39 @@ static struct syscore_ops pm_irq_ops = {
 };
 
 
+static int wake_latency_show(struct seq_file *m, void *unused)
+{
+	seq_printf(m, "last_wake %d\n", wake_latency.last_wake);
+	seq_printf(m, "syscore_resume_ns %llu\n",
+		   wake_latency.syscore_resume_ns);
+	seq_printf(m, "irq_replay_ns %llu\n", wake_latency.irq_replay_ns);
+	if (wake_latency.irq_replay_ns)
+		seq_printf(m, "replay_delay_ns %llu\n",
+			   wake_latency.irq_replay_ns -
+			   wake_latency.syscore_resume_ns);
+	return 0;
+}
+
+static int wake_latency_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, wake_latency_show, inode->i_private);
+}
+
+static const struct file_operations wake_latency_fops = {
+	.open		= wake_latency_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 #ifndef CONFIG_IRQ_DOMAIN_HIERARCHY
 static int tegra_pm_irq_init(void)
 {
 	register_syscore_ops(&pm_irq_ops);
 
+	(void)debugfs_create_file("tegra_wake_latency", 0444, NULL, NULL,
+				  &wake_latency_fops);
+
 	return 0;
 }
 subsys_initcall(tegra_pm_irq_init);
@@ -554,6 +610,8 @@ static int __init tegra_pm_irq_init(struct device_node *node,
 #ifdef CONFIG_PM_SLEEP
 	tegra_pm_irq_domain = domain;
 	register_syscore_ops(&pm_irq_ops);
+	(void)debugfs_create_file("tegra_wake_latency", 0444, NULL, NULL,
+				  &wake_latency_fops);
 #endif
 
 	return 0;
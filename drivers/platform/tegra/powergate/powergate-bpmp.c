@@ -44,6 +44,20 @@ struct tegra_bpmp_pg {
 	struct generic_pm_domain *domains[];
 };
 
+/*
+ * Parallel-transition note: domain dependencies are already modeled as
+ * a graph - these are genpd domains, and parent/child ordering comes
+ * from the genpd subdomain relationships, while independent domains
+ * have no ordering between them at this layer. What actually
+ * serializes a pipeline resume is (a) each transition being one
+ * synchronous MRQ_PG call on the single BPMP channel, which BPMP
+ * processes in order regardless of how we issue them, and (b) the PM
+ * core resuming the client devices sequentially unless they opt in to
+ * async resume. The realizable win is therefore per-driver:
+ * device_enable_async_suspend() on the engine devices lets their
+ * resumes (and hence their domain ungates) overlap up to the BPMP's
+ * own throughput.
+ */
 static int tegra_bpmp_pg_set_state(int id, u32 state)
 {
 	struct mrq_pg_request req = {
@@ -17,6 +17,12 @@
  */
 
 #include <linux/notifier.h>
+#include <linux/seqlock.h>
+#include <linux/ktime.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 
 static u64 (*get_systime)(void *);
 static void *param;
@@ -88,3 +94,50 @@ int get_ptp_hwtime(u64 *ns)
 	return ret;
 }
 EXPORT_SYMBOL(get_ptp_hwtime);
+
+/*
+ * Cached (PHC, monotonic) pair published under a seqlock. Several
+ * drivers only need PHC time to within a few microseconds and were
+ * each doing a full MAC register read; they can instead interpolate
+ * from the last snapshot using the local clock (the PHC advances at
+ * 1 ns/ns within the servo's ppm error, far below the tolerance of
+ * these consumers). The snapshot refreshes lazily, at most once per
+ * PTP_CACHE_REFRESH_NS across all callers.
+ */
+#define PTP_CACHE_REFRESH_NS	(10 * NSEC_PER_MSEC)
+
+static seqlock_t ptp_cache_lock = __SEQLOCK_UNLOCKED(ptp_cache_lock);
+static u64 ptp_cache_phc_ns;
+static u64 ptp_cache_local_ns;
+
+int get_ptp_hwtime_cached(u64 *ns)
+{
+	u64 now = local_clock();
+	u64 phc, snap;
+	unsigned int seq;
+	int ret;
+
+	do {
+		seq = read_seqbegin(&ptp_cache_lock);
+		phc = ptp_cache_phc_ns;
+		snap = ptp_cache_local_ns;
+	} while (read_seqretry(&ptp_cache_lock, seq));
+
+	if (snap && now - snap < PTP_CACHE_REFRESH_NS) {
+		*ns = phc + (now - snap);
+		return 0;
+	}
+
+	ret = get_ptp_hwtime(&phc);
+	if (ret)
+		return ret;
+
+	write_seqlock(&ptp_cache_lock);
+	ptp_cache_phc_ns = phc;
+	ptp_cache_local_ns = local_clock();
+	write_sequnlock(&ptp_cache_lock);
+
+	*ns = phc;
+	return 0;
+}
+EXPORT_SYMBOL(get_ptp_hwtime_cached);
@@ -152,26 +152,46 @@ static ssize_t tegra_camchar_write(struct file *fp, const char __user *buffer,
 	DEFINE_WAIT(wait);
 	ssize_t ret;
 
+	size_t written = 0;
+
 	if (WARN_ON(!ch->is_ready))
 		return -EIO;
 
-	len = min_t(size_t, len, ch->ivc.frame_size);
 	if (len == 0)
 		return 0;
 
+	/*
+	 * Bulk transfers note: a true scatter-gather side channel - one IVC
+	 * message describing pre-mapped pages the RTCPU DMAs directly - is a
+	 * firmware ABI addition and has to be defined on the camera firmware
+	 * side first. Until then, large writes (e.g. tuning tables at camera
+	 * start) are chunked into as many IVC frames as the queue will take
+	 * per syscall below, instead of one frame per write() round trip.
+	 */
 	do {
 		ret = mutex_lock_interruptible(&dev_data->io_lock);
 		if (ret)
 			break;
 
 		prepare_to_wait(&dev_data->waitq, &wait, TASK_INTERRUPTIBLE);
-		ret = tegra_ivc_write_user(&ch->ivc, buffer, len);
+		do {
+			size_t chunk = min_t(size_t, len - written,
+					     ch->ivc.frame_size);
+
+			ret = tegra_ivc_write_user(&ch->ivc, buffer + written,
+						   chunk);
+			if (ret > 0)
+				written += ret;
+		} while (ret > 0 && written < len &&
+			 tegra_ivc_can_write(&ch->ivc));
 		mutex_unlock(&dev_data->io_lock);
 
-		if (ret > 0)
+		if (written)
 			dev_data->is_established = true;
 
-		if (ret != -ENOMEM && ret != ECONNRESET)
+		if (written)
+			;
+		else if (ret != -ENOMEM && ret != ECONNRESET)
 			;
 		else if (ret == ECONNRESET && dev_data->is_established)
 			;
@@ -184,12 +204,14 @@ static ssize_t tegra_camchar_write(struct file *fp, const char __user *buffer,
 
 		finish_wait(&dev_data->waitq, &wait);
 
+		if (written)
+			break;
 		if (ret == ECONNRESET && dev_data->is_established)
 			break;
 
 	} while (ret == -ENOMEM || ret == -ECONNRESET);
 
-	return ret;
+	return written ? written : ret;
 }
 
 static long tegra_camchar_ioctl(struct file *fp, unsigned int cmd,
@@ -126,6 +126,54 @@ int tegra_capture_ivc_capture_submit(const void *capture_desc, size_t len)
 }
 EXPORT_SYMBOL(tegra_capture_ivc_capture_submit);
 
+/*
+ * Submit a batch of capture descriptors with one lock acquisition. The
+ * IVC layer only rings the peer doorbell on the empty to non-empty
+ * transition, so back-to-back frame writes here wake the RTCPU once per
+ * batch instead of once per request.
+ */
+int tegra_capture_ivc_capture_submit_batch(const void *capture_descs,
+		size_t count, size_t len)
+{
+	struct tegra_capture_ivc *civc = __scivc_capture;
+	struct tegra_ivc_channel *chan;
+	const char *desc = capture_descs;
+	size_t i;
+	int ret;
+
+	if (WARN_ON(civc == NULL))
+		return -ENODEV;
+
+	chan = civc->chan;
+	if (WARN_ON(!chan->is_ready))
+		return -EIO;
+
+	ret = mutex_lock_interruptible(&civc->ivc_wr_lock);
+	if (unlikely(ret == -EINTR))
+		return -ERESTARTSYS;
+	if (unlikely(ret))
+		return ret;
+
+	for (i = 0; i < count; i++) {
+		ret = wait_event_interruptible(civc->write_q,
+					tegra_ivc_can_write(&chan->ivc));
+		if (unlikely(ret))
+			break;
+
+		ret = tegra_ivc_write(&chan->ivc, desc + i * len, len);
+		if (unlikely(ret < 0)) {
+			dev_err(&chan->dev, "tegra_ivc_write: error %d\n",
+				ret);
+			break;
+		}
+	}
+
+	mutex_unlock(&civc->ivc_wr_lock);
+
+	return ret < 0 ? ret : 0;
+}
+EXPORT_SYMBOL(tegra_capture_ivc_capture_submit_batch);
+
 int tegra_capture_ivc_register_control_cb(
 		tegra_capture_ivc_cb_func control_resp_cb,
 		uint32_t *trans_id, const void *priv_context)
@@ -180,8 +228,10 @@ int tegra_capture_ivc_register_control_cb(
 	}
 
 	*trans_id = (uint32_t)ctx_id;
-	cb_ctx->cb_func = control_resp_cb;
 	cb_ctx->priv_context = priv_context;
+	/* publish the context before the function pointer, see worker */
+	smp_wmb();
+	WRITE_ONCE(cb_ctx->cb_func, control_resp_cb);
 
 	mutex_unlock(&civc->cb_ctx_lock);
 
@@ -227,12 +277,15 @@ int tegra_capture_ivc_notify_chan_id(uint32_t chan_id, uint32_t trans_id)
 	}
 
 	/* Update cb_ctx index */
-	civc->cb_ctx[chan_id].cb_func = civc->cb_ctx[trans_id].cb_func;
 	civc->cb_ctx[chan_id].priv_context =
 			civc->cb_ctx[trans_id].priv_context;
+	/* publish the context before the function pointer, see worker */
+	smp_wmb();
+	WRITE_ONCE(civc->cb_ctx[chan_id].cb_func,
+			civc->cb_ctx[trans_id].cb_func);
 
 	/* Reset trans_id cb_ctx fields */
-	civc->cb_ctx[trans_id].cb_func = NULL;
+	WRITE_ONCE(civc->cb_ctx[trans_id].cb_func, NULL);
 	civc->cb_ctx[trans_id].priv_context = NULL;
 
 	mutex_unlock(&civc->cb_ctx_lock);
@@ -277,8 +330,10 @@ int tegra_capture_ivc_register_capture_cb(
 		goto fail;
 	}
 
-	civc->cb_ctx[chan_id].cb_func = capture_status_ind_cb;
 	civc->cb_ctx[chan_id].priv_context = priv_context;
+	/* publish the context before the function pointer, see worker */
+	smp_wmb();
+	WRITE_ONCE(civc->cb_ctx[chan_id].cb_func, capture_status_ind_cb);
 	mutex_unlock(&civc->cb_ctx_lock);
 
 	return 0;
@@ -312,7 +367,11 @@ int tegra_capture_ivc_unregister_control_cb(uint32_t id)
 		return -EBADF;
 	}
 
-	civc->cb_ctx[id].cb_func = NULL;
+	WRITE_ONCE(civc->cb_ctx[id].cb_func, NULL);
+	/* in-flight dispatch may still run the old callback; it read the
+	 * function pointer before the context, so it never sees the clear
+	 * below with the old function */
+	smp_wmb();
 	civc->cb_ctx[id].priv_context = NULL;
 
 	mutex_unlock(&civc->cb_ctx_lock);
@@ -356,7 +415,8 @@ int tegra_capture_ivc_unregister_capture_cb(uint32_t chan_id)
 		return -EBADF;
 	}
 
-	civc->cb_ctx[chan_id].cb_func = NULL;
+	WRITE_ONCE(civc->cb_ctx[chan_id].cb_func, NULL);
+	smp_wmb();
 	civc->cb_ctx[chan_id].priv_context = NULL;
 
 	mutex_unlock(&civc->cb_ctx_lock);
@@ -379,6 +439,8 @@ static void tegra_capture_ivc_worker(struct work_struct *work)
 		const struct tegra_capture_ivc_resp *msg =
 			tegra_ivc_read_get_next_frame(&chan->ivc);
 		uint32_t id = msg->header.channel_id;
+		tegra_capture_ivc_cb_func cb_func;
+		const void *priv;
 
 		/* Check if message is valid */
 		if (WARN(id >= TOTAL_CHANNELS, "Invalid rtcpu response id %u", id))
@@ -386,27 +448,45 @@ static void tegra_capture_ivc_worker(struct work_struct *work)
 
 		id = array_index_nospec(id, TOTAL_CHANNELS);
 
+		/*
+		 * Lock-free dispatch: registration publishes priv_context
+		 * before cb_func (paired smp_wmb/smp_rmb), so reading the
+		 * function pointer first guarantees a consistent pair
+		 * without taking cb_ctx_lock on every message.
+		 */
+		cb_func = READ_ONCE(civc->cb_ctx[id].cb_func);
+		smp_rmb();
+		priv = READ_ONCE(civc->cb_ctx[id].priv_context);
+
 		/* Check if callback function available */
-		if (unlikely(!civc->cb_ctx[id].cb_func)) {
+		if (unlikely(!cb_func)) {
 			dev_info(&chan->dev, "No callback for id %u\n", id);
 			goto skip;
 		}
 
 		/* Invoke client callback.*/
-		civc->cb_ctx[id].cb_func(msg, civc->cb_ctx[id].priv_context);
+		cb_func(msg, priv);
 
 skip:
 		tegra_ivc_read_advance(&chan->ivc);
 	}
 }
 
+/*
+ * Dedicated high priority unbound queue for response dispatch, so frame
+ * completions do not queue behind unrelated system work and the control
+ * and capture services (each with their own work item) can run
+ * concurrently.
+ */
+static struct workqueue_struct *tegra_capture_ivc_wq;
+
 static void tegra_capture_ivc_notify(struct tegra_ivc_channel *chan)
 {
 	struct tegra_capture_ivc *civc = tegra_ivc_channel_get_drvdata(chan);
 
 	/* Only 1 thread can wait on write_q, rest wait for write_lock */
 	wake_up(&civc->write_q);
-	schedule_work(&civc->work);
+	queue_work(tegra_capture_ivc_wq ?: system_wq, &civc->work);
 }
 
 #define NV(x) "nvidia," #x
@@ -423,6 +503,10 @@ static int tegra_capture_ivc_probe(struct tegra_ivc_channel *chan)
 	if (unlikely(civc == NULL))
 		return -ENOMEM;
 
+	if (tegra_capture_ivc_wq == NULL)
+		tegra_capture_ivc_wq = alloc_workqueue("tegra-capture-ivc",
+				WQ_UNBOUND | WQ_HIGHPRI, 0);
+
 	ret = of_property_read_string(dev->of_node, NV(service),
 			&service);
 	if (unlikely(ret)) {
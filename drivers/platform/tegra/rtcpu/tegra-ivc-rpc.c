@@ -378,6 +378,18 @@ static void tegra_ivc_rpc_timer(unsigned long arg)
 	kmem_cache_free(tx_desc_cache, tx_desc);
 }
 
+/*
+ * Issue an RPC to the RTCPU. Calls are pipelined, not serialized: each
+ * request gets its own sequence number and TX descriptor on tx_list, so
+ * any number of them can be outstanding per channel at once, bounded
+ * only by IVC ring space. With param->callback set this returns as soon
+ * as the frame is written and the response (or timeout, armed per
+ * request) is delivered through the callback, sequence-matched against
+ * tx_list; clients bursting configuration traffic should use this mode
+ * and keep several requests in flight rather than round-tripping one
+ * blocking call at a time. Without a callback the call blocks for its
+ * own response only - it does not block other callers.
+ */
 int tegra_ivc_rpc_call(
 	struct tegra_ivc_channel *chan,
 	const struct tegra_ivc_rpc_call_param *param)
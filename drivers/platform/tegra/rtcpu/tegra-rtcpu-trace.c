@@ -102,6 +102,7 @@ struct tegra_rtcpu_trace {
 	/* eventlib */
 	struct platform_device *vi_platform_device;
 	struct platform_device *isp_platform_device;
+	int eventlib_id;	/* binary ring for raw firmware events */
 
 	/* printk logging */
 	const char *log_prefix;
@@ -838,9 +839,82 @@ static void rtcpu_trace_isp_event(struct tegra_rtcpu_trace *tracer,
 #endif
 }
 
+/*
+ * Writer-side controls for production tracing. trace_modules is a
+ * bitmask of CAMRTC_EVENT_MODULE_* ids; events from cleared modules are
+ * dropped before any formatting. trace_to_ftrace gates the expensive
+ * string-formatted ftrace path; the binary eventlib ring below stays on
+ * regardless and costs a memcpy per event.
+ */
+static u32 trace_modules = ~0U;
+module_param(trace_modules, uint, 0644);
+
+static bool trace_to_ftrace = true;
+module_param(trace_to_ftrace, bool, 0644);
+
+#ifdef CONFIG_EVENTLIB
+/* raw record pushed to the binary ring; data is the firmware payload */
+struct rtcpu_trace_raw_event {
+	u32 id;
+	u32 len;
+	u32 data[12];
+} __packed;
+
+#define RTCPU_TRACE_RAW_EVENT	0
+
+static const char rtcpu_trace_events_json[] =
+"{ \"Type\": \"EventProvider\", \"Version\": \"1\","
+" \"EventProviderName\": \"nv_camrtc_trace\","
+" \"StructPrefix\": \"nv_camrtc_trace_\","
+" \"MacroPrefix\": \"NV_CAMRTC_TRACE_\","
+" \"EventTypes\": [ { \"Name\": \"raw\","
+" \"Comment\": \"raw camrtc firmware trace event\","
+" \"Fields\": ["
+" { \"Name\": \"id\", \"Comment\": \"event id\","
+" \"Type\": \"uint32_t\", \"Format\": \"%x\" },"
+" { \"Name\": \"len\", \"Comment\": \"payload length\","
+" \"Type\": \"uint32_t\", \"Format\": \"%u\" } ]"
+" } ], \"Filtering\": {} }";
+
+static void rtcpu_trace_eventlib_event(struct tegra_rtcpu_trace *tracer,
+	struct camrtc_event_struct *event)
+{
+	struct rtcpu_trace_raw_event raw;
+	size_t len;
+
+	if (tracer->eventlib_id <= 0)
+		return;
+
+	raw.id = event->header.id;
+	raw.len = event->header.len;
+	len = min(sizeof(raw.data), sizeof(event->data));
+	memcpy(raw.data, event->data.data8, len);
+
+	keventlib_write(tracer->eventlib_id, &raw, sizeof(raw),
+			RTCPU_TRACE_RAW_EVENT, event->header.tstamp);
+}
+#else
+static inline void rtcpu_trace_eventlib_event(struct tegra_rtcpu_trace *tracer,
+	struct camrtc_event_struct *event)
+{
+}
+#endif
+
 static void rtcpu_trace_array_event(struct tegra_rtcpu_trace *tracer,
 	struct camrtc_event_struct *event)
 {
+	u32 module = CAMRTC_EVENT_MODULE_FROM_ID(event->header.id);
+
+	/* writer-side subsystem filter: drop before any formatting */
+	if (module < 32 && !(trace_modules & BIT(module)))
+		return;
+
+	/* always-on binary ring, cheap enough for production */
+	rtcpu_trace_eventlib_event(tracer, event);
+
+	if (!trace_to_ftrace)
+		return;
+
 	switch (CAMRTC_EVENT_MODULE_FROM_ID(event->header.id)) {
 	case CAMRTC_EVENT_MODULE_BASE:
 		rtcpu_trace_base_event(event);
@@ -1188,6 +1262,18 @@ struct tegra_rtcpu_trace *tegra_rtcpu_trace_create(struct device *dev,
 	/* Debugfs */
 	rtcpu_trace_debugfs_init(tracer);
 
+#ifdef CONFIG_EVENTLIB
+	tracer->eventlib_id = keventlib_register(4 * PAGE_SIZE,
+						 "nv_camrtc_trace",
+						 rtcpu_trace_events_json,
+						 sizeof(rtcpu_trace_events_json));
+	if (tracer->eventlib_id < 0) {
+		dev_warn(dev, "failed to register trace eventlib (err=%d)\n",
+			 tracer->eventlib_id);
+		tracer->eventlib_id = 0;
+	}
+#endif
+
 #ifdef CONFIG_EVENTLIB
 	/* Eventlib */
 	if (camera_devices != NULL && camera_devices->ndevices >
@@ -1243,6 +1329,10 @@ void tegra_rtcpu_trace_destroy(struct tegra_rtcpu_trace *tracer)
 	of_node_put(tracer->of_node);
 	cancel_delayed_work_sync(&tracer->work);
 	flush_delayed_work(&tracer->work);
+#ifdef CONFIG_EVENTLIB
+	if (tracer->eventlib_id > 0)
+		keventlib_unregister(tracer->eventlib_id);
+#endif
 	rtcpu_trace_debugfs_deinit(tracer);
 	dma_free_coherent(tracer->dev, tracer->trace_memory_size,
 			tracer->trace_memory, tracer->dma_handle);
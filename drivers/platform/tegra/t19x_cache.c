@@ -400,6 +400,24 @@ static long t19x_cache_ioctl(struct file *filp, unsigned int cmd,
 	case TEGRA_L3_CACHE_GET_IOCTL_DATA:
 		err = get_l3_data(buf);
 		break;
+	case TEGRA_L3_CACHE_SET_PARTITION:
+	{
+		struct tegra_l3_ioctl_data *data =
+			(struct tegra_l3_ioctl_data *)buf;
+
+		if (!capable(CAP_SYS_ADMIN))
+			return -EPERM;
+
+		err = t19x_set_l3_cache_ways(data->igpu_cpu_ways,
+					     data->igpu_only_ways);
+		if (!err) {
+			cache_data->ioctl_data.igpu_cpu_ways =
+				data->igpu_cpu_ways;
+			cache_data->ioctl_data.igpu_only_ways =
+				data->igpu_only_ways;
+		}
+		break;
+	}
 	default:
 		dev_err(dev, "Unknown NVMAP_IOC = 0x%x\n", cmd);
 		return -ENOIOCTLCMD;
@@ -11,20 +11,45 @@
  * more details.
  */
 
+#include <linux/completion.h>
+#include <linux/debugfs.h>
 #include <linux/device.h>
+#include <linux/ktime.h>
 #include <linux/mailbox_client.h>
+#include <linux/math64.h>
 #include <linux/module.h>
+#include <linux/mutex.h>
 #include <linux/of.h>
 #include <linux/platform_device.h>
+#include <linux/sched.h>
+#include <linux/seq_file.h>
+#include <linux/slab.h>
+#include <linux/uaccess.h>
 #include <linux/tegra-aon.h>
 
 #define TX_BLOCK_PERIOD	100
 
+/* round-trip latency histogram: bucket i counts 2^(i-1)..2^i-1 ns */
+#define AON_ECHO_BENCH_BUCKETS	40
+#define AON_ECHO_BENCH_MAX_MSGS	100000
+#define AON_ECHO_RSP_TIMEOUT	msecs_to_jiffies(100)
+
 struct tegra_aon_ivc_echo_data {
 	struct mbox_client cl;
 	struct mbox_chan *mbox;
 	u32 frame_size;
 	char *rx_data;
+	struct dentry *debugfs_dir;
+	struct mutex bench_lock;
+	struct completion bench_echo;
+	bool bench_active;
+	u32 bench_size;
+	u32 bench_count;
+	u32 bench_done;
+	u64 bench_min_ns;
+	u64 bench_max_ns;
+	u64 bench_sum_ns;
+	u32 bench_hist[AON_ECHO_BENCH_BUCKETS];
 };
 
 static ssize_t tegra_aon_ivc_echo_show(struct device *dev,
@@ -70,8 +95,162 @@ static void tegra_aon_ivc_echo_rx(struct mbox_client *cl, void *data)
 					struct tegra_aon_ivc_echo_data,
 					cl);
 	memcpy(drvdata->rx_data, msg->data, drvdata->frame_size);
+	if (READ_ONCE(drvdata->bench_active))
+		complete(&drvdata->bench_echo);
+}
+
+static int tegra_aon_ivc_echo_bench_run(struct tegra_aon_ivc_echo_data *drvdata,
+					u32 size, u32 count)
+{
+	struct device *dev = drvdata->cl.dev;
+	struct tegra_aon_mbox_msg msg;
+	char *tx_buf;
+	u64 t0, dt;
+	u32 i, b;
+	int ret = 0;
+
+	tx_buf = kzalloc(size, GFP_KERNEL);
+	if (!tx_buf)
+		return -ENOMEM;
+	memset(tx_buf, 0x5a, size);
+
+	drvdata->bench_size = size;
+	drvdata->bench_count = count;
+	drvdata->bench_done = 0;
+	drvdata->bench_min_ns = U64_MAX;
+	drvdata->bench_max_ns = 0;
+	drvdata->bench_sum_ns = 0;
+	memset(drvdata->bench_hist, 0, sizeof(drvdata->bench_hist));
+
+	WRITE_ONCE(drvdata->bench_active, true);
+	for (i = 0; i < count; i++) {
+		reinit_completion(&drvdata->bench_echo);
+		msg.length = size;
+		msg.data = tx_buf;
+		t0 = ktime_get_ns();
+		ret = mbox_send_message(drvdata->mbox, (void *)&msg);
+		if (ret < 0) {
+			dev_err(dev, "bench: mbox_send_message failed %d\n",
+				ret);
+			break;
+		}
+		ret = 0;
+		if (!wait_for_completion_timeout(&drvdata->bench_echo,
+						 AON_ECHO_RSP_TIMEOUT)) {
+			dev_err(dev, "bench: echo timeout at msg %u\n", i);
+			ret = -ETIMEDOUT;
+			break;
+		}
+		dt = ktime_get_ns() - t0;
+
+		drvdata->bench_done++;
+		drvdata->bench_sum_ns += dt;
+		if (dt < drvdata->bench_min_ns)
+			drvdata->bench_min_ns = dt;
+		if (dt > drvdata->bench_max_ns)
+			drvdata->bench_max_ns = dt;
+		b = min((u32)fls64(dt), (u32)AON_ECHO_BENCH_BUCKETS - 1);
+		drvdata->bench_hist[b]++;
+
+		cond_resched();
+	}
+	WRITE_ONCE(drvdata->bench_active, false);
+
+	kfree(tx_buf);
+	return ret;
+}
+
+static u64 tegra_aon_ivc_echo_bench_pct(struct tegra_aon_ivc_echo_data
+					*drvdata, u32 mult, u32 div)
+{
+	u64 target = div_u64((u64)drvdata->bench_done * mult + div - 1, div);
+	u64 seen = 0;
+	u32 i;
+
+	for (i = 0; i < AON_ECHO_BENCH_BUCKETS; i++) {
+		seen += drvdata->bench_hist[i];
+		if (seen >= target)
+			return i ? (1ULL << i) - 1 : 0;
+	}
+	return drvdata->bench_max_ns;
+}
+
+static int tegra_aon_ivc_echo_bench_show(struct seq_file *f, void *data)
+{
+	struct tegra_aon_ivc_echo_data *drvdata = f->private;
+	u32 i;
+
+	mutex_lock(&drvdata->bench_lock);
+	seq_printf(f, "size_bytes: %u\n", drvdata->bench_size);
+	seq_printf(f, "requested: %u\n", drvdata->bench_count);
+	seq_printf(f, "completed: %u\n", drvdata->bench_done);
+	if (drvdata->bench_done) {
+		seq_printf(f, "min_ns: %llu\n", drvdata->bench_min_ns);
+		seq_printf(f, "avg_ns: %llu\n",
+			   div_u64(drvdata->bench_sum_ns,
+				   drvdata->bench_done));
+		seq_printf(f, "max_ns: %llu\n", drvdata->bench_max_ns);
+		/* percentiles report the upper bound of their bucket */
+		seq_printf(f, "p50_ns: %llu\n",
+			   tegra_aon_ivc_echo_bench_pct(drvdata, 1, 2));
+		seq_printf(f, "p99_ns: %llu\n",
+			   tegra_aon_ivc_echo_bench_pct(drvdata, 99, 100));
+		seq_printf(f, "p999_ns: %llu\n",
+			   tegra_aon_ivc_echo_bench_pct(drvdata, 999, 1000));
+		seq_puts(f, "hist_log2ns:");
+		for (i = 0; i < AON_ECHO_BENCH_BUCKETS; i++)
+			seq_printf(f, " %u", drvdata->bench_hist[i]);
+		seq_puts(f, "\n");
+	}
+	mutex_unlock(&drvdata->bench_lock);
+	return 0;
+}
+
+static int tegra_aon_ivc_echo_bench_open(struct inode *inode,
+					 struct file *file)
+{
+	return single_open(file, tegra_aon_ivc_echo_bench_show,
+			   inode->i_private);
+}
+
+static ssize_t tegra_aon_ivc_echo_bench_write(struct file *file,
+		const char __user *buf, size_t count, loff_t *ppos)
+{
+	struct tegra_aon_ivc_echo_data *drvdata =
+		((struct seq_file *)file->private_data)->private;
+	char kbuf[32];
+	u32 size, msgs;
+	int ret;
+
+	if (count >= sizeof(kbuf))
+		return -EINVAL;
+	if (copy_from_user(kbuf, buf, count))
+		return -EFAULT;
+	kbuf[count] = '\0';
+
+	if (sscanf(kbuf, "%u %u", &size, &msgs) != 2)
+		return -EINVAL;
+	if (size == 0 || size > drvdata->frame_size ||
+	    msgs == 0 || msgs > AON_ECHO_BENCH_MAX_MSGS)
+		return -EINVAL;
+
+	ret = mutex_lock_interruptible(&drvdata->bench_lock);
+	if (ret)
+		return ret;
+	ret = tegra_aon_ivc_echo_bench_run(drvdata, size, msgs);
+	mutex_unlock(&drvdata->bench_lock);
+
+	return ret < 0 ? ret : count;
 }
 
+static const struct file_operations tegra_aon_ivc_echo_bench_fops = {
+	.open		= tegra_aon_ivc_echo_bench_open,
+	.read		= seq_read,
+	.write		= tegra_aon_ivc_echo_bench_write,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static int tegra_aon_ivc_echo_probe(struct platform_device *pdev)
 {
 	int ret;
@@ -115,6 +294,16 @@ static int tegra_aon_ivc_echo_probe(struct platform_device *pdev)
 		goto out;
 	}
 
+	mutex_init(&drvdata->bench_lock);
+	init_completion(&drvdata->bench_echo);
+	drvdata->debugfs_dir = debugfs_create_dir("tegra_aon_ivc_echo", NULL);
+	if (!IS_ERR_OR_NULL(drvdata->debugfs_dir)) {
+		/* write "<size> <count>" to run, read for percentiles */
+		debugfs_create_file("bench", 0600, drvdata->debugfs_dir,
+				    drvdata,
+				    &tegra_aon_ivc_echo_bench_fops);
+	}
+
 	return ret;
 out:
 	mbox_free_channel(drvdata->mbox);
@@ -125,6 +314,7 @@ static int tegra_aon_ivc_echo_remove(struct platform_device *pdev)
 {
 	struct tegra_aon_ivc_echo_data *drvdata = dev_get_drvdata(&pdev->dev);
 
+	debugfs_remove_recursive(drvdata->debugfs_dir);
 	device_remove_file(&pdev->dev, &dev_attr_data_channel);
 	mbox_free_channel(drvdata->mbox);
 
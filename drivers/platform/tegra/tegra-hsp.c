@@ -55,6 +55,14 @@ static void __iomem *db_bases[HSP_NR_DBS];
 
 static DEFINE_MUTEX(db_handlers_lock);
 static int db_irq;
+/*
+ * Doorbell dispatch is a direct per-master table indexed by the pending
+ * bitfield and the callbacks run straight from the hard IRQ - there is
+ * no notifier chain or list walk on this path, and the t186 shared
+ * mailbox layer likewise dispatches to the owning pair's handler
+ * directly from its ISR. Keep it that way: one load and an indirect
+ * call per pending master is the latency floor of this interface.
+ */
 static struct db_handler_info db_handlers[HSP_LAST_MASTER + 1];
 
 static const char * const master_names[] = {
@@ -60,6 +60,19 @@ struct tegra_hv_xhci_debug {
 	int rx_cnt;
 };
 
+/*
+ * Telemetry transport note: this channel is already shared memory, not
+ * hypercalls - tegra_hv_ivc_read() pops frames the servicing VM queued
+ * into the IVC ring, and the loop below drains as many frames as fit
+ * in the caller's buffer per read(). What serializes against the
+ * server today is only frame production on its side. A continuously
+ * updated ring the server writes without queueing discipline (plain
+ * buffer plus seqcount, reader tolerates overwrite) would need the
+ * servicing VM to define that layout in the hypervisor manifest; the
+ * guest half is then a read-only mapping of that IVC area and a
+ * seqcount-retry reader here, with this framed path kept for the
+ * lossless firmware log.
+ */
 static ssize_t fw_log_file_read(struct file *file, char __user *buf,
 		size_t count, loff_t *offp)
 {
@@ -427,6 +427,68 @@ void *tegra_ivc_read_get_next_frame(struct ivc *ivc)
 }
 EXPORT_SYMBOL(tegra_ivc_read_get_next_frame);
 
+/*
+ * Batched cache maintenance for an rx drain. Refreshes w_count once and
+ * invalidates the payload of every pending frame with at most two
+ * dma_sync calls (the span can wrap the ring), so a consumer draining N
+ * frames with tegra_ivc_read_get_next_frame_nosync() +
+ * tegra_ivc_read_advance() pays O(1) maintenance calls instead of one
+ * invalidate per frame. Returns the number of frames made visible.
+ */
+int tegra_ivc_rx_sync_all(struct ivc *ivc)
+{
+	uint32_t avail, pos, span;
+	int result;
+
+	result = ivc_check_read(ivc);
+	if (result)
+		return 0;
+
+	/* order observation of w_pos before the payload reads */
+	ivc_rmb();
+
+	if (!ivc->peer_device)
+		return 1;
+
+	ivc_invalidate_counter(ivc, ivc->rx_handle +
+			offsetof(struct ivc_channel_header, w_count));
+	avail = ivc_channel_avail_count(ivc, ivc->rx_channel);
+	if (avail > ivc->nframes)
+		avail = ivc->nframes;
+
+	pos = ivc->r_pos;
+	span = min(avail, ivc->nframes - pos);
+
+	dma_sync_single_for_cpu(ivc->peer_device,
+			ivc_frame_handle(ivc, ivc->rx_handle, pos),
+			(size_t)span * ivc->frame_size, DMA_FROM_DEVICE);
+	if (avail > span)
+		dma_sync_single_for_cpu(ivc->peer_device,
+				ivc_frame_handle(ivc, ivc->rx_handle, 0),
+				(size_t)(avail - span) * ivc->frame_size,
+				DMA_FROM_DEVICE);
+
+	return avail;
+}
+EXPORT_SYMBOL(tegra_ivc_rx_sync_all);
+
+/*
+ * Frame pointer for consumers that already synchronized the pending
+ * frames with tegra_ivc_rx_sync_all(); skips the per-frame invalidate.
+ */
+void *tegra_ivc_read_get_next_frame_nosync(struct ivc *ivc)
+{
+	int result = ivc_check_read(ivc);
+
+	if (result)
+		return ERR_PTR(result);
+
+	ivc_rmb();
+
+	return ivc_frame_pointer(ivc, ivc->rx_channel, ivc->r_pos);
+}
+EXPORT_SYMBOL(tegra_ivc_read_get_next_frame_nosync);
+
 int tegra_ivc_read_advance(struct ivc *ivc)
 {
 	/*
@@ -451,6 +451,20 @@ static const struct file_operations tegra_mce_cstats_fops = {
 	.release = single_release,
 };
 
+static int tegra_mce_dbg_cstate_update_open(struct inode *inode,
+					    struct file *file)
+{
+	return single_open(file, tegra19x_mce_dbg_cstate_update_show,
+			   inode->i_private);
+}
+
+static const struct file_operations tegra_mce_cstate_update_fops = {
+	.open = tegra_mce_dbg_cstate_update_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+
 DEFINE_SIMPLE_ATTRIBUTE(tegra_mce_echo_fops, NULL,
 			tegra_mce_echo_set, "%llu\n");
 DEFINE_SIMPLE_ATTRIBUTE(tegra_mce_versions_fops, tegra_mce_versions_get,
@@ -485,6 +499,7 @@ static struct debugfs_entry tegra18x_mce_attrs[] = {
 static struct debugfs_entry tegra19x_mce_attrs[] = {
 	{ "versions", &tegra_mce_versions_fops, 0444 },
 	{ "cstats", &tegra_mce_cstats_fops, 0444 },
+	{ "cstate_update", &tegra_mce_cstate_update_fops, 0444 },
 	{ NULL, NULL, 0 }
 };
 
@@ -127,6 +127,18 @@ static unsigned int tegra_safety_dev_poll(struct file *fp, poll_table *pt)
 	return ret;
 }
 
+/*
+ * Checksum note: no safety frame CRC is computed in this driver - the
+ * kernel only relays opaque frames between the SCE's IVC queues and
+ * the safety service, and the E2E checksum is generated and verified
+ * by the endpoints (service library and SCE firmware) per the
+ * certified protocol. Offloading those checksums to the SE engine or
+ * batching them through the ARMv8 CRC32 instructions is therefore an
+ * endpoint change; doing it here would both double-compute and move a
+ * certified function into uncertified code. If the service library
+ * ever wants kernel help, the hook point is a frame-sized ioctl on
+ * this device, not the read/write fast path.
+ */
 static ssize_t tegra_safety_dev_read(struct file *fp, char __user *buffer,
 		size_t len, loff_t *offset)
 {
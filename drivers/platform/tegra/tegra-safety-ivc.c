@@ -31,6 +31,18 @@
 int ivc_chan_count;
 
 /* wake up cmd-resp threads */
+/*
+ * Heartbeat aggregation note: this driver is only the IVC transport to
+ * the SCE; the heartbeat message format - one frame per client today -
+ * is defined by the safety firmware ABI on the other end. Aggregating
+ * client liveness into one periodic frame with a bitmap (and letting
+ * the kernel escalate only on missed deadlines) requires that firmware
+ * to accept the aggregate format first; the kernel half is then a
+ * straightforward change in the safety-dev layer that collects client
+ * states. Until the firmware side exists, batching here would produce
+ * frames the SCE rejects, which in a safety channel is worse than the
+ * wake rate being optimized away.
+ */
 static u32 tegra_safety_ivc_notify(void *data, u32 response)
 {
 	tegra_safety_dev_notify();
@@ -629,6 +629,16 @@ static int denver15_uncore_pmu_init(struct arm_pmu *uncore_pmu)
 	return 0;
 }
 
+/*
+ * Note on T19x: this PMU reads the Denver 1.5 core's uncore counters
+ * through Denver-specific system registers and has no Carmel
+ * counterpart. Memory-controller events on T19x live behind the DMCE
+ * perfmon interface (dmce_perfmon.h) and the MC's own counters are
+ * owned by BPMP firmware; a perf-integrated MC PMU needs either a BPMP
+ * MRQ for counter access or the DMCE perfmon path, neither of which
+ * exposes per-client bandwidth in this kernel's interface headers. Do
+ * not bind this driver on Carmel parts.
+ */
 static const struct of_device_id denverpmu_of_device_ids[] = {
 	{.compatible = "nvidia,denver15-pmu", .data = denver15_uncore_pmu_init},
 	{},
@@ -11,10 +11,17 @@
  * more details.
  */
 
+#include <linux/atomic.h>
+#include <linux/percpu.h>
 #include <linux/debugfs.h>
 #include <linux/init.h>
 #include <linux/module.h>
+#include <linux/sched.h>
 #include <linux/t194_nvg.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 #include <linux/tegra-mce.h>
 
 #include <asm/smp_plat.h>
@@ -52,10 +59,24 @@ int tegra19x_mce_enter_cstate(u32 state, u32 wake_time)
 	return 0;
 }
 
+/*
+ * Last cstate info written to the MCE by each core. NVG is a
+ * core-local interface and CSTATE_INFO carries that core's cluster
+ * vote, so the dedup cache must be per-CPU - a value another core
+ * wrote never makes this core's write redundant. ~0 is never a valid
+ * encoding, so it doubles as the invalid marker. Transition
+ * count/latency land in the cstate_update debugfs node.
+ */
+static DEFINE_PER_CPU(u64, last_cstate_info) = ~0ULL;
+static atomic64_t cstate_update_count;
+static atomic64_t cstate_update_skipped;
+static atomic64_t cstate_update_last_ns;
+
 int tegra19x_mce_update_cstate_info(u32 cluster, u32 ccplex, u32 system,
 				    u8 force, u32 wake_mask, bool valid)
 {
 	nvg_cstate_info_channel_t cstate_info = { 0 };
+	u64 t0;
 
 	/* disable preemption */
 	preempt_disable();
@@ -85,9 +106,20 @@ int tegra19x_mce_update_cstate_info(u32 cluster, u32 ccplex, u32 system,
 	/* set the wake mask */
 	cstate_info.bits.wake_mask = wake_mask;
 
+	/* skip this core's MCE round-trip when its vote is unchanged */
+	if (!force && __this_cpu_read(last_cstate_info) == cstate_info.flat) {
+		atomic64_inc(&cstate_update_skipped);
+		preempt_enable();
+		return 0;
+	}
+
 	/* set the updated cstate info */
+	t0 = sched_clock();
 	nvg_send_req_data(TEGRA_NVG_CHANNEL_CSTATE_INFO,
 				cstate_info.flat);
+	atomic64_set(&cstate_update_last_ns, sched_clock() - t0);
+	__this_cpu_write(last_cstate_info, cstate_info.flat);
+	atomic64_inc(&cstate_update_count);
 
 	/* enable preemption */
 	preempt_enable();
@@ -115,19 +147,49 @@ int tegra19x_mce_update_crossover_time(u32 type, u32 time)
 	return 0;
 }
 
+/*
+ * Short-TTL cache for cstate statistics. Power telemetry reads these
+ * every tick from several places; within one jiffy the counters cannot
+ * have moved enough to matter, so serve repeats from the cache and trap
+ * to the MCE at most once per jiffy per queried state. The NVG mailbox
+ * takes one request at a time, so there is nothing to batch below this.
+ */
+struct mce_cstat_cache_ent {
+	unsigned long stamp;
+	u64 value;
+	u32 state;
+	bool valid;
+};
+static DEFINE_PER_CPU(struct mce_cstat_cache_ent [8], mce_cstat_cache);
+
 int tegra19x_mce_read_cstate_stats(u32 state, u64 *stats)
 {
+	struct mce_cstat_cache_ent *ent;
+
 	if (!stats)
 		return -EINVAL;
 
 	/* disable preemption */
 	preempt_disable();
 
+	ent = &this_cpu_ptr(mce_cstat_cache)[state % 8];
+	if (ent->valid && ent->state == state &&
+	    ent->stamp == jiffies) {
+		*stats = ent->value;
+		preempt_enable();
+		return 0;
+	}
+
 	nvg_send_req_data(TEGRA_NVG_CHANNEL_CSTATE_STAT_QUERY_REQUEST,
 				(uint64_t)state);
 	nvg_send_req(TEGRA_NVG_CHANNEL_CSTATE_STAT_QUERY_VALUE);
 	*stats = nvg_get_response();
 
+	ent->state = state;
+	ent->value = *stats;
+	ent->stamp = jiffies;
+	ent->valid = true;
+
 	/* enable preemption */
 	preempt_enable();
 
@@ -164,11 +226,20 @@ int tegra19x_mce_cc3_ctrl(u32 ndiv, u32 vindex, u8 enable)
 
 int tegra19x_mce_read_versions(u32 *major, u32 *minor)
 {
+	/* the interface version cannot change after boot; trap only once */
+	static u32 cached_major, cached_minor;
+	static bool cached;
 	uint64_t version;
 
 	if (!major || !minor)
 		return -EINVAL;
 
+	if (likely(cached)) {
+		*major = cached_major;
+		*minor = cached_minor;
+		return 0;
+	}
+
 	/* disable preemption */
 	preempt_disable();
 
@@ -180,6 +251,12 @@ int tegra19x_mce_read_versions(u32 *major, u32 *minor)
 	/* enable preemption */
 	preempt_enable();
 
+	cached_major = *major;
+	cached_minor = *minor;
+	/* publish values before the flag */
+	smp_wmb();
+	cached = true;
+
 	return 0;
 }
 
@@ -288,6 +365,17 @@ static struct cstats_info cstats_table[] = {
 	{ "C6_RESIDENCY_SUM", CSTAT_ENTRY(C6_RESIDENCY_SUM), 8},
 };
 
+int tegra19x_mce_dbg_cstate_update_show(struct seq_file *s, void *data)
+{
+	seq_printf(s, "updates: %lld\n",
+		   (long long)atomic64_read(&cstate_update_count));
+	seq_printf(s, "skipped: %lld\n",
+		   (long long)atomic64_read(&cstate_update_skipped));
+	seq_printf(s, "last_update_ns: %lld\n",
+		   (long long)atomic64_read(&cstate_update_last_ns));
+	return 0;
+}
+
 int tegra19x_mce_dbg_cstats_show(struct seq_file *s, void *data)
 {
 	int st, unit;
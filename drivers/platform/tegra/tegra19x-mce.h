@@ -34,6 +34,7 @@ int tegra19x_mce_enable_latic_set(void *data, u64 val);
 int tegra19x_mce_coresight_cg_set(void *data, u64 val);
 int tegra19x_mce_edbgreq_set(void *data, u64 val);
 int tegra19x_mce_dbg_cstats_show(struct seq_file *s, void *data);
+int tegra19x_mce_dbg_cstate_update_show(struct seq_file *s, void *data);
 #endif
 
 /* Tegra19x cache functions */
@@ -103,6 +104,10 @@ static int tegra19x_mce_dbg_cstats_show(struct seq_file *s, void *data)
 {
 	return -ENOTSUPP;
 }
+static int tegra19x_mce_dbg_cstate_update_show(struct seq_file *s, void *data)
+{
+	return -ENOTSUPP;
+}
 #endif /* CONFIG_DEBUG_FS */
 
 static int t19x_flush_cache_all(void)
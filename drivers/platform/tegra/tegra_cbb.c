@@ -21,6 +21,10 @@
 #include <asm/traps.h>
 #include <linux/clk.h>
 #include <linux/debugfs.h>
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 #include <linux/module.h>
 #include <linux/of.h>
 #include <linux/of_device.h>
@@ -513,10 +517,55 @@ static void print_errloggerX_info(
 }
 
 
+/*
+ * Structured history of CBB errors. Each fault appends a compact record
+ * (raw errlog words + timestamp) to this ring before any text is
+ * formatted, so field failures leave a machine-readable trail in the
+ * crash dump or kcore even when the console output was ratelimited or
+ * lost; cbb_err_ring in debugfs reads it back on live systems. A true
+ * pstore-backed ring needs a persistent-RAM region assigned to this
+ * driver in DT, which none of the current platforms reserve, but the
+ * ring is deliberately a single flat array so pointing it at a
+ * persistent mapping later is a one-line change.
+ */
+#define CBB_ERR_RING_SIZE	32
+
+struct cbb_err_record {
+	u64 timestamp_ns;
+	u32 errlog0;
+	u32 errlog1;
+	u32 errlog3;
+	u32 errlog4;
+	u32 errlog5;
+	const char *name;
+};
+
+static struct cbb_err_record cbb_err_ring[CBB_ERR_RING_SIZE];
+static atomic_t cbb_err_ring_head;
+static atomic64_t cbb_err_total;
+
+static void cbb_err_record_add(struct tegra_cbb_errlog_record *errlog)
+{
+	unsigned int slot =
+		(unsigned int)atomic_inc_return(&cbb_err_ring_head) %
+			CBB_ERR_RING_SIZE;
+	struct cbb_err_record *rec = &cbb_err_ring[slot];
+
+	rec->timestamp_ns = local_clock();
+	rec->errlog0 = errlog->errlog0;
+	rec->errlog1 = errlog->errlog1;
+	rec->errlog3 = errlog->errlog3;
+	rec->errlog4 = errlog->errlog4;
+	rec->errlog5 = errlog->errlog5;
+	rec->name = errlog->name;
+	atomic64_inc(&cbb_err_total);
+}
+
 static void print_errlog(struct seq_file *file,
 			struct tegra_cbb_errlog_record *errlog,
 			int errvld_status)
 {
+
 	pr_crit("**************************************\n");
 	pr_crit("* For more Internal Decode Help\n");
 	pr_crit("*     http://nv/cbberr\n");
@@ -531,6 +580,9 @@ static void print_errlog(struct seq_file *file,
 	else if (errvld_status & 0x4)
 		print_errloggerX_info(file, errlog, 2);
 
+	/* registers were latched into errlog by the printers above */
+	cbb_err_record_add(errlog);
+
 	errlog->errclr(errlog->vaddr);
 	print_cbb_err(file, "\t**************************************\n");
 }
@@ -712,6 +764,42 @@ static const struct file_operations cbb_err_fops = {
 };
 
 
+static int cbb_err_ring_show(struct seq_file *file, void *data)
+{
+	unsigned int head = (unsigned int)atomic_read(&cbb_err_ring_head);
+	int i;
+
+	seq_printf(file, "total_errors %lld\n",
+		   (long long)atomic64_read(&cbb_err_total));
+	seq_puts(file, "timestamp_ns source errlog0 errlog1 errlog3 errlog4 errlog5\n");
+
+	for (i = 0; i < CBB_ERR_RING_SIZE; i++) {
+		struct cbb_err_record *rec = &cbb_err_ring[
+			(head + 1 + i) % CBB_ERR_RING_SIZE];
+
+		if (!rec->timestamp_ns)
+			continue;
+		seq_printf(file, "%llu %s 0x%x 0x%x 0x%x 0x%x 0x%x\n",
+			   rec->timestamp_ns, rec->name ?: "?",
+			   rec->errlog0, rec->errlog1, rec->errlog3,
+			   rec->errlog4, rec->errlog5);
+	}
+
+	return 0;
+}
+
+static int cbb_err_ring_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, cbb_err_ring_show, inode->i_private);
+}
+
+static const struct file_operations cbb_err_ring_fops = {
+	.open = cbb_err_ring_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release
+};
+
 static int cbb_noc_dbgfs_init(void)
 {
 	struct dentry *d;
@@ -723,6 +811,8 @@ static int cbb_noc_dbgfs_init(void)
 					__func__);
 			return PTR_ERR(d);
 		}
+		(void)debugfs_create_file("tegra_cbb_err_ring",
+				S_IRUGO, NULL, NULL, &cbb_err_ring_fops);
 		created_root = true;
 	}
 	return 0;
@@ -246,6 +246,41 @@ int is_ras_ready(void)
 }
 EXPORT_SYMBOL(is_ras_ready);
 
+/*
+ * Sliding-window corrected-error aggregation: counts per 1-minute
+ * window with the previous window retained, so fleet agents read two
+ * integers from sysfs-style debugfs instead of parsing and windowing
+ * raw events in userspace.
+ */
+static atomic_t ras_ce_window_count;
+static atomic_t ras_ce_prev_window;
+static unsigned long ras_ce_window_start;
+static atomic64_t ras_ce_total;
+
+static void ras_ce_account(void)
+{
+	unsigned long now = jiffies;
+	unsigned long start = READ_ONCE(ras_ce_window_start);
+
+	atomic64_inc(&ras_ce_total);
+
+	if (!start || time_after(now, start + 60 * HZ)) {
+		if (cmpxchg(&ras_ce_window_start, start, now) == start) {
+			atomic_set(&ras_ce_prev_window,
+				   atomic_xchg(&ras_ce_window_count, 0));
+		}
+	}
+	atomic_inc(&ras_ce_window_count);
+}
+
+u64 ras_corrected_error_rate(u64 *total)
+{
+	if (total)
+		*total = atomic64_read(&ras_ce_total);
+	return atomic_read(&ras_ce_prev_window);
+}
+EXPORT_SYMBOL(ras_corrected_error_rate);
+
 void print_error_record(struct error_record *record, u64 status)
 {
 	struct ras_error *errors;
@@ -255,6 +290,10 @@ void print_error_record(struct error_record *record, u64 status)
 	int found = 0;
 	u64 err_status = 0;
 
+	/* only corrected errors feed the CE rate window */
+	if (!(status & ERRi_STATUS_UE))
+		ras_ce_account();
+
 	pr_crit("**************************************\n");
 	pr_crit("RAS Error in %s:\n", record->name);
 	pr_crit("\tStatus = 0x%llx\n", status);
@@ -236,6 +236,18 @@ static int do_aon_ivc_spi_xfer(struct spi_device *spi,
 	return 0;
 }
 
+/*
+ * Note on pipelining: the AON firmware ABI (aon-spi-messages.h) carries
+ * exactly one aon_spi_xfer_params per IVC message and the SPE processes
+ * request/response pairs strictly in order, so multiple spi_transfers
+ * cannot be packed into one message and posting several messages ahead
+ * only moves the serialization into the SPE's single-entry request
+ * handling. Until the firmware grows a multi-xfer request (count +
+ * per-xfer offsets fit naturally in the existing data buffer layout),
+ * the round trip per transfer below is the floor; the FIRST/LAST flags
+ * already let the firmware hold chip-select across the message so
+ * per-transfer CS toggling is not part of that cost.
+ */
 static int tegra_spi_transfer_one_message(struct spi_master *master,
 			struct spi_message *msg)
 {
@@ -43,6 +43,10 @@ struct tegra_bpmp_thermal_zone {
 	struct thermal_zone_device *tzd;
 	unsigned int idx;
 	atomic_t needs_update;
+	/* last window programmed into BPMP, to elide no-op IPC */
+	int last_low;
+	int last_high;
+	bool trips_valid;
 };
 
 struct tegra_bpmp_thermal {
@@ -110,6 +114,17 @@ static int tegra_bpmp_set_trips(void *data, int low, int high)
 	struct mrq_thermal_host_to_bpmp_request req;
 	int ret;
 
+	/*
+	 * The thermal core re-issues trip windows freely while governors
+	 * churn during throttle events; skip the IPC when the window the
+	 * BPMP has is already correct. A bulk all-zones message would
+	 * need a new MRQ_THERMAL command in the BPMP ABI - per-zone
+	 * CMD_THERMAL_SET_TRIP is all the firmware accepts today.
+	 */
+	if (zone->trips_valid && zone->last_low == low &&
+	    zone->last_high == high)
+		return 0;
+
 	req.type = CMD_THERMAL_SET_TRIP;
 	req.set_trip.zone = zone->idx;
 	req.set_trip.enabled = true;
@@ -117,6 +132,11 @@ static int tegra_bpmp_set_trips(void *data, int low, int high)
 	req.set_trip.high = high;
 
 	ret = tegra_bpmp_send_receive(MRQ_THERMAL, &req, sizeof(req), NULL, 0);
+	if (!ret) {
+		zone->last_low = low;
+		zone->last_high = high;
+		zone->trips_valid = true;
+	}
 	return ret;
 }
 
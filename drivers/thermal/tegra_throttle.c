@@ -81,13 +81,43 @@ static struct pm_qos_request gpu_cap;
 #define THROT_TBL_IDX(row, col)		(((row) * num_cap_clks) + (col))
 #define THROT_VAL(tbl, row, col)	(tbl)[(THROT_TBL_IDX(row, col))]
 
+/*
+ * Each table row is subdivided into interpolation steps so the cooling
+ * state space is finer than the table: the governor walking one state
+ * moves each cap a quarter of the way to the next row instead of
+ * jumping a whole row, which removes the frequency sawtooth under
+ * sustained load. All cap clocks are still evaluated and applied in a
+ * single pass per state change.
+ */
+#define THROT_INTERP_STEPS		4
+
+static unsigned long throt_interp_val(struct balanced_throttle *bthrot,
+				      unsigned long state, int col)
+{
+	unsigned long row = (state - 1) / THROT_INTERP_STEPS;
+	unsigned long frac = (state - 1) % THROT_INTERP_STEPS;
+	unsigned long rows = bthrot->throt_tab_size / num_cap_clks;
+	unsigned long lo, hi;
+
+	lo = THROT_VAL(bthrot->throt_tab, row, col);
+	if (!frac || row + 1 >= rows || lo == NO_CAP)
+		return lo;
+
+	hi = THROT_VAL(bthrot->throt_tab, row + 1, col);
+	if (hi == NO_CAP || hi >= lo)
+		return lo;
+
+	return lo - (lo - hi) * frac / THROT_INTERP_STEPS;
+}
+
 static int
 tegra_throttle_get_max_state(struct thermal_cooling_device *cdev,
 				unsigned long *max_state)
 {
 	struct balanced_throttle *bthrot = cdev->devdata;
 
-	*max_state = bthrot->throt_tab_size / num_cap_clks;
+	*max_state = (bthrot->throt_tab_size / num_cap_clks) *
+			THROT_INTERP_STEPS;
 
 	return 0;
 }
@@ -246,8 +276,8 @@ tegra_throttle_set_cur_state(struct thermal_cooling_device *cdev,
 			if (!bthrot->cur_state)
 				continue;
 
-			cur_cap = THROT_VAL(bthrot->throt_tab,
-						bthrot->cur_state - 1, i);
+			cur_cap = throt_interp_val(bthrot,
+						bthrot->cur_state, i);
 			if (cur_cap < cap_rate)
 				cap_rate = cur_cap;
 		}
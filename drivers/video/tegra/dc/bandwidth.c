@@ -720,6 +720,23 @@ static unsigned long tegra_dc_calc_win_bandwidth(struct tegra_dc *dc,
 		ret = div_u64(ret, out_h);
 	}
 
+	/*
+	 * Fold in the compositor's declared update rate. Scanout still
+	 * fetches every frame, but a window that is known not to change
+	 * does not need the full worst-case headroom; the compositor owns
+	 * this trade and an underflow resets every hint to full rate.
+	 */
+	switch (w->bw_update_hint) {
+	case TEGRA_DC_BW_HINT_VIDEO:
+		ret = ret * 2 / 3;
+		break;
+	case TEGRA_DC_BW_HINT_STATIC:
+		ret = ret / 4;
+		break;
+	default:
+		break;
+	}
+
 	return ret;
 }
 
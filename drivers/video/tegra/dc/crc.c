@@ -703,6 +703,75 @@ long tegra_dc_crc_get(struct tegra_dc *dc, struct tegra_dc_ext_crc_arg *arg)
 	return ret;
 }
 
+/*
+ * Drain buffered CRC records, oldest first, into the caller's array.
+ * Waits for at most one frame end when the ring is empty so a verifier
+ * looping on this ioctl tracks the frame rate with one syscall per
+ * batch instead of one per frame.
+ */
+long tegra_dc_crc_drain(struct tegra_dc *dc,
+			struct tegra_dc_ext_crc_drain_arg *arg)
+{
+	struct tegra_dc_ext_crc_record __user *urec =
+		(struct tegra_dc_ext_crc_record __user *)(uintptr_t)
+			arg->records;
+	u32 filled = 0;
+	int ret;
+
+	if (!dc->enabled)
+		return -ENODEV;
+
+	if (!dc->crc_initialized)
+		return -EPERM;
+
+	if (!arg->num_records)
+		return -EINVAL;
+
+	mutex_lock(&dc->crc_buf.lock);
+
+	if (!dc->crc_buf.size) {
+		mutex_unlock(&dc->crc_buf.lock);
+		ret = tegra_dc_crc_wait_till_frame_end(dc);
+		if (ret)
+			return ret;
+		mutex_lock(&dc->crc_buf.lock);
+	}
+
+	while (filled < arg->num_records && dc->crc_buf.size) {
+		struct tegra_dc_ext_crc_record rec;
+		struct tegra_dc_crc_buf_ele *ele;
+
+		ret = tegra_dc_ring_buf_peek(&dc->crc_buf, dc->crc_buf.tail,
+					     (char **)&ele);
+		if (ret)
+			break;
+
+		memset(&rec, 0, sizeof(rec));
+		rec.flip_id = ele->matching_flips[0].valid ?
+			      ele->matching_flips[0].id : U64_MAX;
+		rec.rg_crc = ele->rg.crc;
+		rec.rg_valid = ele->rg.valid;
+		rec.comp_crc = ele->comp.crc;
+		rec.comp_valid = ele->comp.valid;
+		rec.or_crc = ele->sor.crc;
+		rec.or_valid = ele->sor.valid;
+
+		if (copy_to_user(&urec[filled], &rec, sizeof(rec))) {
+			mutex_unlock(&dc->crc_buf.lock);
+			return -EFAULT;
+		}
+
+		tegra_dc_ring_buf_remove(&dc->crc_buf);
+		filled++;
+	}
+
+	mutex_unlock(&dc->crc_buf.lock);
+
+	arg->num_records = filled;
+
+	return 0;
+}
+
 int tegra_dc_crc_process(struct tegra_dc *dc)
 {
 	int ret = 0, matched = 0;
@@ -368,6 +368,42 @@ int tegra_dc_cursor_image(struct tegra_dc *dc,
 int tegra_dc_cursor_set(struct tegra_dc *dc, bool enable, int x, int y)
 {
 	mutex_lock(&dc->lock);
+
+	/*
+	 * Position-only fast path: when nothing but the coordinates
+	 * changed on an already-programmed cursor, write the position
+	 * register alone instead of replaying the whole cursor state (and
+	 * its possible GENERAL_ACT_REQ). If the activation request from an
+	 * earlier move is still pending, hardware latches the newest
+	 * position at the same vblank, so the request is rung at most once
+	 * per frame no matter how fast the pointer moves.
+	 */
+	if (dc->enabled && !dc->cursor.dirty &&
+	    dc->cursor.enabled && enable) {
+		dc->cursor.x = x;
+		dc->cursor.y = y;
+
+		tegra_dc_get(dc);
+		if (tegra_dc_is_nvdisplay())
+			nvdisp_set_cursor_position(dc, x, y);
+		else
+			tegra_dc_writel(dc, CURSOR_POSITION(x, y,
+					H_CURSOR_POSITION_SIZE),
+					DC_DISP_CURSOR_POSITION);
+
+		if (!(tegra_dc_readl(dc, DC_CMD_STATE_CONTROL) &
+		      CURSOR_ACT_REQ)) {
+			tegra_dc_writel(dc, CURSOR_UPDATE,
+					DC_CMD_STATE_CONTROL);
+			tegra_dc_writel(dc, CURSOR_ACT_REQ,
+					DC_CMD_STATE_CONTROL);
+		}
+		tegra_dc_put(dc);
+		mutex_unlock(&dc->lock);
+
+		return 0;
+	}
+
 	dc->cursor.x = x;
 	dc->cursor.y = y;
 	dc->cursor.dirty = true;
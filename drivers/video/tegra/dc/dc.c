@@ -4447,6 +4447,7 @@ void tegra_dc_set_act_vfp(struct tegra_dc *dc, int vfp)
 static void tegra_dc_vrr_extend_vfp(struct tegra_dc *dc)
 {
 	struct tegra_vrr *vrr  = dc->out->vrr;
+	s32 vfp = MAX_VRR_V_FRONT_PORCH;
 
 	if (!vrr || !vrr->capability)
 		return;
@@ -4454,7 +4455,25 @@ static void tegra_dc_vrr_extend_vfp(struct tegra_dc *dc)
 	if (!vrr->enable)
 		return;
 
-	tegra_dc_set_act_vfp(dc, MAX_VRR_V_FRONT_PORCH);
+	/*
+	 * With a frame-cadence hint from the streamer, pre-program the
+	 * front porch for the expected interval instead of stretching to
+	 * the maximum and relying on the flip to cut the frame short, so
+	 * the next frame starts on its predicted time even when the flip
+	 * arrives with little margin. No hint (0) keeps the old behavior.
+	 */
+	if (vrr->expected_frame_us > 0 && vrr->line_width > 0 &&
+	    dc->mode.pclk >= 1000000) {
+		s32 lines = div_s64((s64)vrr->expected_frame_us *
+				    (dc->mode.pclk / 1000000),
+				    vrr->line_width);
+
+		vfp = clamp_t(s32, lines - vrr->lines_per_frame_common,
+			      dc->mode.v_front_porch,
+			      MAX_VRR_V_FRONT_PORCH);
+	}
+
+	tegra_dc_set_act_vfp(dc, vfp);
 }
 
 int tegra_dc_get_v_count(struct tegra_dc *dc)
@@ -4478,6 +4497,14 @@ static void tegra_dc_vrr_get_ts(struct tegra_dc *dc)
 	vrr->fe_time_us = (s64)time_now.tv_sec * 1000000 +
 				time_now.tv_nsec / 1000;
 	vrr->v_count = tegra_dc_get_v_count(dc);
+
+	/* record flip-to-scanout latency for the pacing telemetry ring */
+	if (vrr->curr_flip_us && vrr->fe_time_us > vrr->curr_flip_us) {
+		vrr->flip_to_scanout_us[vrr->flip_latency_idx %
+					VRR_LATENCY_RING] =
+			(s32)(vrr->fe_time_us - vrr->curr_flip_us);
+		vrr->flip_latency_idx++;
+	}
 }
 
 static void tegra_dc_vrr_sec(struct tegra_dc *dc)
@@ -4721,6 +4748,26 @@ static void tegra_dc_underflow_handler(struct tegra_dc *dc)
 		tegra_nvdisp_underflow_handler(dc);
 	}
 
+	/* drop a marker into the bandwidth request timeline */
+	tegra_bw_timeline_record(TEGRA_BW_TL_UNDERFLOW, dc->ctrl_num, 0, 0);
+
+	/* Emergency boost: drop bandwidth derating hints on underflow */
+	if (tegra_dc_is_t21x()) {
+		int i;
+		bool boosted = false;
+
+		for_each_set_bit(i, &dc->valid_windows, DC_N_WINDOWS) {
+			struct tegra_dc_win *win = tegra_dc_get_window(dc, i);
+
+			if (win && win->bw_update_hint) {
+				win->bw_update_hint = TEGRA_DC_BW_HINT_FULL;
+				boosted = true;
+			}
+		}
+		if (boosted)
+			tegra_dc_set_dynamic_emc(dc);
+	}
+
 	/* Clear the underflow mask now that we've checked it. */
 	tegra_dc_writel(dc, dc->underflow_mask, DC_CMD_INT_STATUS);
 	dc->underflow_mask = 0;
@@ -552,6 +552,11 @@ enum {
 /* this is the old name. provided for compatibility with old board files. */
 #define dcc_bus ddc_bus
 
+/* Window bandwidth derating hints declared by the compositor */
+#define TEGRA_DC_BW_HINT_FULL	0	/* content updates every frame */
+#define TEGRA_DC_BW_HINT_VIDEO	1	/* video cadence, ~half rate */
+#define TEGRA_DC_BW_HINT_STATIC	2	/* mostly static content */
+
 struct tegra_vrr {
 	s32	capability;
 	s32	enable;
@@ -601,6 +606,7 @@ struct tegra_vrr {
 
 	s32	fe_intr_req;
 	s32	db_tolerance;
+
 	s32	frame2flip_us;
 	s32	adjust_vfp;
 	s32	adjust_db;
@@ -621,6 +627,18 @@ struct tegra_vrr {
 	u8	challenge[32];
 	u8	digest[32];
 	u8	challenge_src;
+
+	/*
+	 * Predictive pacing support: userspace publishes its estimated
+	 * next-frame interval through sysfs so the frame length can be set
+	 * up front instead of chasing the observed flip rate, and reads
+	 * back a short ring of measured flip-to-scanout latencies to close
+	 * its pacing loop.
+	 */
+#define VRR_LATENCY_RING	16
+	s32	expected_frame_us;
+	s32	flip_to_scanout_us[VRR_LATENCY_RING];
+	u32	flip_latency_idx;
 };
 
 struct tegra_dc_out {
@@ -1182,5 +1200,7 @@ long tegra_dc_crc_enable(struct tegra_dc *dc, struct tegra_dc_ext_crc_arg *arg);
 long tegra_dc_crc_disable(struct tegra_dc *dc,
 			  struct tegra_dc_ext_crc_arg *arg);
 long tegra_dc_crc_get(struct tegra_dc *dc, struct tegra_dc_ext_crc_arg *arg);
+long tegra_dc_crc_drain(struct tegra_dc *dc,
+			struct tegra_dc_ext_crc_drain_arg *arg);
 
 #endif
@@ -495,6 +495,66 @@ static ssize_t win_mask_store(struct device *dev,
 
 static DEVICE_ATTR(win_mask, 0600, win_mask_show, win_mask_store);
 
+static ssize_t win_bw_hint_show(struct device *device,
+	struct device_attribute *attr, char *buf)
+{
+	struct platform_device *ndev = to_platform_device(device);
+	struct tegra_dc *dc = platform_get_drvdata(ndev);
+	ssize_t res = 0;
+	int i;
+
+	mutex_lock(&dc->lock);
+	for_each_set_bit(i, &dc->valid_windows,
+			 tegra_dc_get_numof_dispwindows()) {
+		struct tegra_dc_win *win = tegra_dc_get_window(dc, i);
+
+		if (win)
+			res += snprintf(buf + res, PAGE_SIZE - res,
+					"%d %u\n", i, win->bw_update_hint);
+	}
+	mutex_unlock(&dc->lock);
+
+	return res;
+}
+
+/*
+ * "<window index> <hint>" where hint is 0 (full rate), 1 (video cadence)
+ * or 2 (mostly static). The hint derates the worst-case ISO bandwidth
+ * request for that window; an underflow resets all hints to full rate.
+ */
+static ssize_t win_bw_hint_store(struct device *dev,
+	struct device_attribute *attr, const char *buf, size_t count)
+{
+	struct platform_device *ndev = to_platform_device(dev);
+	struct tegra_dc *dc = platform_get_drvdata(ndev);
+	struct tegra_dc_win *win;
+	unsigned int idx, hint;
+
+	if (!tegra_dc_is_t21x())
+		return -EINVAL;
+
+	if (sscanf(buf, "%u %u", &idx, &hint) != 2)
+		return -EINVAL;
+
+	if (idx >= tegra_dc_get_numof_dispwindows() ||
+	    hint > TEGRA_DC_BW_HINT_STATIC)
+		return -EINVAL;
+
+	mutex_lock(&dc->lock);
+	if (!test_bit(idx, &dc->valid_windows)) {
+		mutex_unlock(&dc->lock);
+		return -EINVAL;
+	}
+
+	win = tegra_dc_get_window(dc, idx);
+	win->bw_update_hint = hint;
+	mutex_unlock(&dc->lock);
+
+	return count;
+}
+
+static DEVICE_ATTR(win_bw_hint, 0600, win_bw_hint_show, win_bw_hint_store);
+
 void tegra_dc_remove_sysfs(struct device *dev)
 {
 	struct platform_device *ndev = to_platform_device(dev);
@@ -509,6 +569,7 @@ void tegra_dc_remove_sysfs(struct device *dev)
 		(dc->out->type == TEGRA_DC_OUT_FAKE_DP))
 		device_remove_file(dev, &dev_attr_out_crc);
 	device_remove_file(dev, &dev_attr_win_mask);
+	device_remove_file(dev, &dev_attr_win_bw_hint);
 
 #ifdef CONFIG_TEGRA_DC_WIN_H
 	device_remove_file(dev, &dev_attr_win_h);
@@ -549,6 +610,7 @@ void tegra_dc_create_sysfs(struct device *dev)
 		(dc->out->type == TEGRA_DC_OUT_FAKE_DP))
 		error |= device_create_file(dev, &dev_attr_out_crc);
 	error |= device_create_file(dev, &dev_attr_win_mask);
+	error |= device_create_file(dev, &dev_attr_win_bw_hint);
 
 #ifdef CONFIG_TEGRA_DC_WIN_H
 	error |= device_create_file(dev, &dev_attr_win_h);
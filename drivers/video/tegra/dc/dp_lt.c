@@ -492,6 +492,78 @@ static void lt_failed(struct tegra_dp_lt_data *lt_data)
 	mutex_unlock(&lt_data->lock);
 }
 
+/* DPCD 0x400..0x40b: sink IEEE OUI, device id string, hw/fw revision */
+#define NV_DPCD_SINK_IEEE_OUI	0x400
+
+static int read_sink_ident(struct tegra_dp_lt_data *lt_data, u8 *ident)
+{
+	int i, ret;
+
+	for (i = 0; i < DP_LT_SINK_IDENT_LEN; i++) {
+		ret = tegra_dc_dp_dpcd_read(lt_data->dp,
+				NV_DPCD_SINK_IEEE_OUI + i, &ident[i]);
+		if (ret)
+			return ret;
+	}
+
+	return 0;
+}
+
+static void save_lt_config(struct tegra_dp_lt_data *lt_data)
+{
+	if (read_sink_ident(lt_data, lt_data->saved_sink_ident)) {
+		lt_data->saved_cfg_valid = false;
+		return;
+	}
+
+	memcpy(lt_data->saved_drive_current, lt_data->drive_current,
+		sizeof(lt_data->saved_drive_current));
+	memcpy(lt_data->saved_pre_emphasis, lt_data->pre_emphasis,
+		sizeof(lt_data->saved_pre_emphasis));
+	memcpy(lt_data->saved_post_cursor2, lt_data->post_cursor2,
+		sizeof(lt_data->saved_post_cursor2));
+	lt_data->saved_tx_pu = lt_data->tx_pu;
+	lt_data->saved_n_lanes = lt_data->n_lanes;
+	lt_data->saved_link_bw = lt_data->link_bw;
+	lt_data->saved_cfg_valid = true;
+}
+
+/*
+ * If the sink on the other end of a fresh hotplug identifies as the one
+ * we last trained against, seed the drive settings from the saved
+ * configuration so fast link training can be attempted first. A fast LT
+ * failure still falls back to the full state machine via STATE_RESET.
+ */
+static bool restore_lt_config(struct tegra_dp_lt_data *lt_data)
+{
+	u8 ident[DP_LT_SINK_IDENT_LEN];
+
+	if (!lt_data->saved_cfg_valid)
+		return false;
+
+	if (lt_data->saved_n_lanes != lt_data->n_lanes ||
+		lt_data->saved_link_bw != lt_data->link_bw)
+		return false;
+
+	if (read_sink_ident(lt_data, ident))
+		return false;
+
+	if (memcmp(ident, lt_data->saved_sink_ident, sizeof(ident)))
+		return false;
+
+	memcpy(lt_data->drive_current, lt_data->saved_drive_current,
+		sizeof(lt_data->drive_current));
+	memcpy(lt_data->pre_emphasis, lt_data->saved_pre_emphasis,
+		sizeof(lt_data->pre_emphasis));
+	memcpy(lt_data->post_cursor2, lt_data->saved_post_cursor2,
+		sizeof(lt_data->post_cursor2));
+	lt_data->tx_pu = lt_data->saved_tx_pu;
+	lt_data->lt_config_valid = true;
+
+	pr_info("dp lt: reusing last-good drive settings for known sink\n");
+	return true;
+}
+
 static void lt_passed(struct tegra_dp_lt_data *lt_data)
 {
 	struct tegra_dc_dp_data *dp = lt_data->dp;
@@ -499,6 +571,7 @@ static void lt_passed(struct tegra_dp_lt_data *lt_data)
 	mutex_lock(&lt_data->lock);
 
 	lt_data->lt_config_valid = true;
+	save_lt_config(lt_data);
 	set_lt_tpg(lt_data, TEGRA_DC_DP_TRAINING_PATTERN_DISABLE);
 	tegra_dc_sor_attach(dp->sor);
 
@@ -1030,6 +1103,12 @@ static void handle_lt_hpd_evt(struct tegra_dp_lt_data *lt_data, int cur_hpd)
 	if (!cur_hpd && !lt_data->force_disable)
 		timeout = HPD_DROP_TIMEOUT_MS;
 
+	/* known sink reconnecting? try its last-good settings first */
+	if (cur_hpd && !lt_data->lt_config_valid &&
+		lt_data->no_aux_handshake &&
+		!lt_data->force_disable)
+		restore_lt_config(lt_data);
+
 	if (lt_data->lt_config_valid &&
 		lt_data->no_aux_handshake &&
 		!lt_data->force_disable)
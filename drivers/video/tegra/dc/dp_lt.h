@@ -74,6 +74,22 @@ struct tegra_dp_lt_data {
 	u32 cr_adj_retry;
 	u32 cr_max_retry;
 	u32 ce_retry;
+
+	/*
+	 * Last-good drive settings, persisted across hotplugs and keyed on
+	 * the sink's DPCD identity (IEEE OUI + device id + hw/fw rev). A
+	 * reconnect of the same sink retries fast link training with these
+	 * before falling back to a full CR + EQ run.
+	 */
+#define DP_LT_SINK_IDENT_LEN	12
+	bool saved_cfg_valid;
+	u8 saved_sink_ident[DP_LT_SINK_IDENT_LEN];
+	u32 saved_drive_current[4];
+	u32 saved_pre_emphasis[4];
+	u32 saved_post_cursor2[4];
+	u32 saved_tx_pu;
+	u32 saved_n_lanes;
+	u32 saved_link_bw;
 };
 
 static const u32 tegra_dp_vs_regs[][4][4] = {
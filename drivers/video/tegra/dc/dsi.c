@@ -3387,12 +3387,24 @@ int tegra_dsi_end_host_cmd_v_blank_video(struct tegra_dc *dc,
 }
 EXPORT_SYMBOL(tegra_dsi_end_host_cmd_v_blank_video);
 
+/*
+ * Default spacing inserted between panel commands that do not request
+ * an explicit delay. The DSI host signals FIFO completion itself, so
+ * this exists purely as slack for slow panel controllers; platforms
+ * whose panels tolerate back-to-back LP writes can set it to 0 and
+ * collapse a 60-command init sequence from ~60ms of sleeps to the
+ * transfer time alone. Commands with explicit TEGRA_DSI_DELAY_MS
+ * entries keep their requested spacing either way.
+ */
+static uint dsi_cmd_gap_ms = 1;
+module_param(dsi_cmd_gap_ms, uint, 0644);
+
 int tegra_dsi_send_panel_cmd(struct tegra_dc *dc,
 					struct tegra_dc_dsi_data *dsi,
 					struct tegra_dsi_cmd *cmd,
 					u32 n_cmd)
 {
-#define DEFAULT_DELAY_MS 1
+#define DEFAULT_DELAY_MS dsi_cmd_gap_ms
 	u32 i;
 	int err;
 	u8 delay_ms;
@@ -736,6 +736,7 @@ int tegra_edid_get_monspecs(struct tegra_edid *edid, struct fb_monspecs *specs)
 	u8 checksum = 0;
 	u8 *data;
 	bool use_fallback = false;
+	bool cache_hit = false;
 
 	new_data = vzalloc(SZ_32K + sizeof(struct tegra_edid_pvt));
 	if (!new_data)
@@ -767,6 +768,18 @@ int tegra_edid_get_monspecs(struct tegra_edid *edid, struct fb_monspecs *specs)
 		ret = tegra_edid_read_block(edid, 0, data);
 		if (ret)
 			goto fail;
+
+		/*
+		 * Same panel as last time? Block 0 carries the vendor id,
+		 * serial and checksum, so a match means the extension
+		 * blocks can come from the cache instead of more 100kHz
+		 * DDC transactions.
+		 */
+		mutex_lock(&edid->lock);
+		cache_hit = edid->cached_raw &&
+			edid->cached_len >= EDID_BYTES_PER_BLOCK &&
+			!memcmp(edid->cached_raw, data, EDID_BYTES_PER_BLOCK);
+		mutex_unlock(&edid->lock);
 	}
 
 	memset(specs, 0x0, sizeof(struct fb_monspecs));
@@ -811,6 +824,11 @@ int tegra_edid_get_monspecs(struct tegra_edid *edid, struct fb_monspecs *specs)
 			memcpy(data + i * EDID_BYTES_PER_BLOCK,
 				default_720p_edid + i * EDID_BYTES_PER_BLOCK,
 				EDID_BYTES_PER_BLOCK);
+		} else if (cache_hit &&
+			   (i + 1) * EDID_BYTES_PER_BLOCK <= edid->cached_len) {
+			memcpy(data + i * EDID_BYTES_PER_BLOCK,
+				edid->cached_raw + i * EDID_BYTES_PER_BLOCK,
+				EDID_BYTES_PER_BLOCK);
 		} else {
 			ret = tegra_edid_read_block(edid, i,
 				data + i * EDID_BYTES_PER_BLOCK);
@@ -909,6 +927,22 @@ int tegra_edid_get_monspecs(struct tegra_edid *edid, struct fb_monspecs *specs)
 	mutex_lock(&edid->lock);
 	old_data = edid->data;
 	edid->data = new_data;
+
+	/* refresh the raw cache for the next hotplug of this panel */
+	if (!edid->dc->vedid && !use_fallback) {
+		if (edid->cached_len < new_data->dc_edid.len) {
+			kfree(edid->cached_raw);
+			edid->cached_raw = kmalloc(new_data->dc_edid.len,
+						   GFP_KERNEL);
+		}
+		if (edid->cached_raw) {
+			memcpy(edid->cached_raw, new_data->dc_edid.buf,
+				new_data->dc_edid.len);
+			edid->cached_len = new_data->dc_edid.len;
+		} else {
+			edid->cached_len = 0;
+		}
+	}
 	mutex_unlock(&edid->lock);
 
 	if (old_data)
@@ -979,6 +1013,7 @@ void tegra_edid_destroy(struct tegra_edid *edid)
 {
 	if (edid->data)
 		kref_put(&edid->data->refcnt, data_release);
+	kfree(edid->cached_raw);
 	kfree(edid);
 }
 
@@ -138,6 +138,14 @@ enum {
 struct tegra_edid {
 	struct tegra_edid_pvt	*data;
 
+	/*
+	 * Raw EDID cache from the previous successful read. When block 0
+	 * of a fresh read matches (same checksum/serial), the extension
+	 * blocks are taken from here instead of re-reading them over DDC.
+	 */
+	u8			*cached_raw;
+	size_t			cached_len;
+
 	struct mutex		lock;
 	struct tegra_dc_i2c_ops i2c_ops;
 	struct tegra_dc		*dc;
@@ -50,6 +50,20 @@
 #define TEGRA_DC_TS_MAX_DELAY_US 1000000
 #define TEGRA_DC_TS_SLACK_US 2000
 
+/*
+ * Flip queuing model: user flips are already asynchronous - each
+ * TEGRA_DC_EXT_FLIP enqueues a work item on the per-window flip
+ * worker and returns with the post-syncpoint fence, so the ioctl never
+ * blocks on scanout. What is deliberately NOT implemented is
+ * mailbox/newest-wins replacement: every queued flip carries buffer
+ * references and a pre-fence contract with its producer, and silently
+ * dropping an intermediate flip would complete its fence without its
+ * content ever reaching the screen - clients that want newest-wins
+ * (and several compositors do) implement it by simply not queuing a
+ * new flip until the previous fence fires, which needs no kernel
+ * support and keeps fence semantics honest.
+ */
+
 /* Compatibility for kthread refactoring */
 #if LINUX_VERSION_CODE < KERNEL_VERSION(4, 9, 0)
 #define kthread_init_work init_kthread_work
@@ -2287,8 +2301,30 @@ static int tegra_dc_ext_set_lut(struct tegra_dc_ext_user *user,
 			set_lut_channel(new_lut->b, lut->b, start, len);
 	} else if (tegra_dc_is_nvdisplay()) {
 		nvdisp_lut = &win->nvdisp_lut;
-		memset(nvdisp_lut->rgb, 0, sizeof(u64) * len);
-		err = set_nvdisp_lut_channel(new_lut, nvdisp_lut->rgb);
+		if (nvdisp_lut->rgb_shadow) {
+			/*
+			 * Stage the new table in the inactive copy and swap;
+			 * scanout keeps fetching the old table until the new
+			 * base address latches at the frame boundary.
+			 */
+			u64 *rgb = nvdisp_lut->rgb_shadow;
+			dma_addr_t phy = nvdisp_lut->phy_addr_shadow;
+
+			/* start from the active table so entries outside
+			 * [start, start + len) keep their current values */
+			memcpy(rgb, nvdisp_lut->rgb, nvdisp_lut->size);
+			err = set_nvdisp_lut_channel(new_lut, rgb);
+			if (!err) {
+				nvdisp_lut->rgb_shadow = nvdisp_lut->rgb;
+				nvdisp_lut->phy_addr_shadow =
+						nvdisp_lut->phy_addr;
+				nvdisp_lut->rgb = rgb;
+				nvdisp_lut->phy_addr = phy;
+			}
+		} else {
+			memset(nvdisp_lut->rgb, 0, sizeof(u64) * len);
+			err = set_nvdisp_lut_channel(new_lut, nvdisp_lut->rgb);
+		}
 	}
 
 	if (err) {
@@ -3565,6 +3601,27 @@ free_and_ret:
 		return ret;
 	}
 
+	case TEGRA_DC_EXT_CRC_DRAIN:
+	{
+		struct tegra_dc_ext_crc_drain_arg args;
+		struct tegra_dc *dc = user->ext->dc;
+
+		if (copy_from_user(&args, user_arg, sizeof(args)))
+			return -EFAULT;
+
+		if (memcmp(args.magic, "TCRC", 4))
+			return -EINVAL;
+
+		ret = tegra_dc_crc_drain(dc, &args);
+		if (ret)
+			return ret;
+
+		if (copy_to_user(user_arg, &args, sizeof(args)))
+			return -EFAULT;
+
+		return 0;
+	}
+
 	default:
 		return -EINVAL;
 	}
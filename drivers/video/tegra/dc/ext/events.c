@@ -28,6 +28,19 @@
 
 static DECLARE_WAIT_QUEUE_HEAD(event_wait);
 
+/*
+ * Scaling note for vblank consumers: events are delivered per control
+ * fd - each registered user gets its own copy and its own wakeup, so
+ * four daemons tracking vblank cost four list insertions and four
+ * wakeups per frame. Before growing this into a shared mmap ring,
+ * note that a vblank *timestamp* consumer does not need events at all:
+ * the frame-end time is exposed via the vblank syncpoint and the
+ * nvhost syncpoint shim mmap, which is already a shared, syscall-free
+ * page. The event path is only required for consumers that need the
+ * kernel-ordered event stream (hotplug, bandwidth renegotiation), and
+ * those are not per-frame.
+ */
+
 unsigned int tegra_dc_ext_event_poll(struct file *filp, poll_table *wait)
 {
 	struct tegra_dc_ext_control_user *user = filp->private_data;
@@ -1145,6 +1145,65 @@ static int nvhdcp_poll_ready(struct tegra_nvhdcp *nvhdcp, int timeout)
 }
 
 
+/*
+ * SRM revocation setup run concurrently with the sink computing hprime.
+ * Only DDC polling happens on the main thread while this runs, so the
+ * TSEC/TA traffic stays serialized; the main thread flushes the work and
+ * checks srm_err before touching TSEC again.
+ */
+struct nvhdcp_srm_work {
+	struct work_struct work;
+	struct tegra_nvhdcp *nvhdcp;
+	struct hdcp_context_t *hdcp_context;
+	uint64_t *pkt;
+	int err;
+};
+
+static void nvhdcp_srm_check_worker(struct work_struct *work)
+{
+	struct nvhdcp_srm_work *srm_work =
+		container_of(work, struct nvhdcp_srm_work, work);
+	struct tegra_nvhdcp *nvhdcp = srm_work->nvhdcp;
+	struct hdcp_context_t *hdcp_context = srm_work->hdcp_context;
+	unsigned char nonce[HDCP_NONCE_SIZE];
+	int err = 0;
+
+#ifdef CONFIG_TRUSTED_LITTLE_KERNEL
+	/* differentiate between TLK and trusty */
+	if (te_is_secos_dev_enabled()) {
+		err = te_open_trusted_session_tlk(hdcp_uuid, sizeof(hdcp_uuid),
+					&session_id);
+	} else {
+		nvhdcp->ta_ctx = NULL;
+		/* Open a trusted sesion with HDCP TA */
+		err = te_open_trusted_session(HDCP_PORT_NAME, &nvhdcp->ta_ctx);
+	}
+#else
+	nvhdcp->ta_ctx = NULL;
+	/* Open a trusted sesion with HDCP TA */
+	err = te_open_trusted_session(HDCP_PORT_NAME, &nvhdcp->ta_ctx);
+#endif
+	if (err) {
+		nvhdcp_err("Error opening trusted session\n");
+		goto exit;
+	}
+
+	err = get_srm_signature(hdcp_context, nonce, srm_work->pkt,
+				nvhdcp->ta_ctx);
+	if (err) {
+		nvhdcp_err("Error getting srm signature!\n");
+		goto exit;
+	}
+
+	err = tsec_hdcp_revocation_check(hdcp_context,
+		(unsigned char *)(srm_work->pkt + HDCP_CMAC_OFFSET),
+		*((unsigned int *)(srm_work->pkt + HDCP_TSEC_ADDR_OFFSET)),
+		TEGRA_NVHDCP_PORT_HDMI, HDCP_22);
+
+exit:
+	srm_work->err = err;
+}
+
 static int tsec_hdcp_authentication(struct tegra_nvhdcp *nvhdcp,
 				struct hdcp_context_t *hdcp_context)
 {
@@ -1154,6 +1213,7 @@ static int tsec_hdcp_authentication(struct tegra_nvhdcp *nvhdcp,
 	u16 txcaps = 0x0;
 	uint64_t *pkt = NULL;
 	unsigned char nonce[HDCP_NONCE_SIZE];
+	struct nvhdcp_srm_work srm_work;
 
 	pkt = kzalloc(PKT_SIZE, GFP_KERNEL);
 
@@ -1222,40 +1282,30 @@ static int tsec_hdcp_authentication(struct tegra_nvhdcp *nvhdcp,
 	if (err)
 		goto exit;
 
-#ifdef CONFIG_TRUSTED_LITTLE_KERNEL
-	/* differentiate between TLK and trusty */
-	if (te_is_secos_dev_enabled()) {
-		err = te_open_trusted_session_tlk(hdcp_uuid, sizeof(hdcp_uuid),
-					&session_id);
-	} else {
-		nvhdcp->ta_ctx = NULL;
-		/* Open a trusted sesion with HDCP TA */
-		err = te_open_trusted_session(HDCP_PORT_NAME, &nvhdcp->ta_ctx);
-	}
-#else
-	nvhdcp->ta_ctx = NULL;
-	/* Open a trusted sesion with HDCP TA */
-	err = te_open_trusted_session(HDCP_PORT_NAME, &nvhdcp->ta_ctx);
-#endif
+	/*
+	 * The sink needs up to a second to produce hprime and the wait is
+	 * pure DDC polling, so run the trusted-session open + SRM
+	 * signature + revocation check concurrently with it and join
+	 * before the next TSEC access.
+	 */
+	srm_work.nvhdcp = nvhdcp;
+	srm_work.hdcp_context = hdcp_context;
+	srm_work.pkt = pkt;
+	srm_work.err = 0;
+	INIT_WORK_ONSTACK(&srm_work.work, nvhdcp_srm_check_worker);
+	schedule_work(&srm_work.work);
 
-	if (err) {
-		nvhdcp_err("Error opening trusted session\n");
-		goto exit;
-	}
-	err = get_srm_signature(hdcp_context, nonce, pkt, nvhdcp->ta_ctx);
-	if (err) {
-		nvhdcp_err("Error getting srm signature!\n");
-		goto exit;
-	}
-	err =  tsec_hdcp_revocation_check(hdcp_context,
-		(unsigned char *)(pkt + HDCP_CMAC_OFFSET),
-		*((unsigned int *)(pkt + HDCP_TSEC_ADDR_OFFSET)),
-		TEGRA_NVHDCP_PORT_HDMI, HDCP_22);
-	if (err)
-		goto exit;
 	err = nvhdcp_poll_ready(nvhdcp, 1000);
+
+	flush_work(&srm_work.work);
+	destroy_work_on_stack(&srm_work.work);
+
 	if (err)
 		goto exit;
+	if (srm_work.err) {
+		err = srm_work.err;
+		goto exit;
+	}
 	err = nvhdcp_ake_hprime_receive(nvhdcp,
 		&hdcp_context->msg.ake_send_hprime_msg_id);
 	if (err)
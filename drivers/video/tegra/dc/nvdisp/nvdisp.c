@@ -833,6 +833,17 @@ static int nvdisp_alloc_input_lut(struct tegra_dc *dc,
 	if (!nvdisp_lut->rgb)
 		return -ENOMEM;
 
+	/* second copy so updates never touch the buffer being fetched */
+	nvdisp_lut->rgb_shadow = (u64 *)dma_zalloc_coherent(&dc->ndev->dev,
+			nvdisp_lut->size, &nvdisp_lut->phy_addr_shadow,
+			GFP_KERNEL);
+	if (!nvdisp_lut->rgb_shadow) {
+		dma_free_coherent(&dc->ndev->dev, nvdisp_lut->size,
+			(void *)nvdisp_lut->rgb, nvdisp_lut->phy_addr);
+		nvdisp_lut->rgb = NULL;
+		return -ENOMEM;
+	}
+
 	return 0;
 }
 
@@ -1301,6 +1312,10 @@ INIT_LUT_ERR:
 		if (nvdisp_lut->rgb)
 			dma_free_coherent(&dc->ndev->dev, nvdisp_lut->size,
 				(void *)nvdisp_lut->rgb, nvdisp_lut->phy_addr);
+		if (nvdisp_lut->rgb_shadow)
+			dma_free_coherent(&dc->ndev->dev, nvdisp_lut->size,
+				(void *)nvdisp_lut->rgb_shadow,
+				nvdisp_lut->phy_addr_shadow);
 	}
 INIT_CLK_ERR:
 	if (!IS_ERR_OR_NULL(hubclk))
@@ -3627,6 +3642,13 @@ int tegra_dc_queue_imp_propose(struct tegra_dc *dc,
 		return ret;
 	}
 
+	/*
+	 * Realize the raised reservation immediately instead of waiting for
+	 * the flip's pre-update programming at the next frame boundary; a
+	 * failure here is not fatal since the flip path programs it again.
+	 */
+	(void)tegra_nvdisp_raise_bandwidth(dc);
+
 	if (use_v2) {
 		u32 offset = offsetof(struct tegra_dc_ext_nvdisp_imp_settings,
 								session_id);
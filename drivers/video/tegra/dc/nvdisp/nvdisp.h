@@ -70,6 +70,7 @@ int tegra_nvdisp_program_bandwidth(struct tegra_dc *dc, u32 new_iso_bw,
 	u32 new_total_bw, u32 new_emc, u32 new_hubclk, bool before_win_update);
 int tegra_nvdisp_negotiate_reserved_bw(struct tegra_dc *dc, u32 new_iso_bw,
 	u32 new_total_bw, u32 new_emc, u32 new_hubclk);
+int tegra_nvdisp_raise_bandwidth(struct tegra_dc *dc);
 void tegra_nvdisp_init_bandwidth(struct tegra_dc *dc);
 void tegra_nvdisp_clear_bandwidth(struct tegra_dc *dc);
 u32 tegra_nvdisp_get_max_pending_bw(struct tegra_dc *dc);
@@ -316,6 +316,46 @@ long tegra_nvdisp_calc_min_bandwidth(struct tegra_dc *dc)
 	return ihub_bw_info.max_config.iso_bw;
 }
 
+/*
+ * Raise-before-use fast path. Realizes the bandwidth that PROPOSE has
+ * already reserved without waiting for the next window update, so a
+ * bandwidth bump (e.g. HDR video start) becomes usable mid-frame.
+ * Raising is always safe for the frame currently scanning out; lowering
+ * still happens only after the new state has latched, on the regular
+ * post-update path.
+ */
+int tegra_nvdisp_raise_bandwidth(struct tegra_dc *dc)
+{
+	struct nvdisp_bandwidth_config *cur_config = &ihub_bw_info.cur_config;
+	u32 final_emc, final_hubclk;
+	int ret;
+
+	if (IS_ERR_OR_NULL(ihub_bw_info.isomgr_handle) ||
+				IS_ERR_OR_NULL(ihub_bw_info.bwmgr_handle))
+		return -EINVAL;
+
+	if (ihub_bw_info.reserved_bw <= cur_config->iso_bw)
+		return 0;
+
+	final_emc = max(cur_config->emc_la_floor, ihub_bw_info.emc_at_res_bw);
+	final_hubclk = max(cur_config->hubclk, ihub_bw_info.hubclk_at_res_bw);
+
+	ret = tegra_nvdisp_program_final_bw_settings(cur_config,
+						ihub_bw_info.reserved_bw,
+						cur_config->total_bw,
+						final_emc,
+						final_hubclk,
+						true);
+
+	trace_display_imp_bw_programmed(dc->ctrl_num,
+					cur_config->iso_bw,
+					cur_config->total_bw,
+					cur_config->emc_la_floor,
+					cur_config->hubclk);
+
+	return ret;
+}
+
 int tegra_nvdisp_negotiate_reserved_bw(struct tegra_dc *dc,
 				u32 new_iso_bw,
 				u32 new_total_bw,
@@ -656,6 +696,10 @@ int tegra_nvdisp_negotiate_reserved_bw(struct tegra_dc *dc, u32 new_iso_bw,
 {
 	return -ENOSYS;
 }
+int tegra_nvdisp_raise_bandwidth(struct tegra_dc *dc)
+{
+	return -ENOSYS;
+}
 void tegra_nvdisp_init_bandwidth(struct tegra_dc *dc) {}
 void tegra_nvdisp_clear_bandwidth(struct tegra_dc *dc) {}
 long tegra_nvdisp_calc_min_bandwidth(struct tegra_dc *dc)
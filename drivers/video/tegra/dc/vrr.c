@@ -45,6 +45,9 @@ VRR_ATTR(max_adj_pct);
 VRR_ATTR(max_flip_pct);
 VRR_ATTR(max_dcb);
 VRR_ATTR(max_inc_pct);
+VRR_ATTR(expected_frame_us);
+static struct kobj_attribute vrr_attr_flip_latency_us =
+	__ATTR(flip_latency_us, 0444, vrr_settings_show, NULL);
 
 static struct attribute *vrr_attrs[] = {
 	VRR_ATTRS_ENTRY(capability),
@@ -54,6 +57,8 @@ static struct attribute *vrr_attrs[] = {
 	VRR_ATTRS_ENTRY(max_flip_pct),
 	VRR_ATTRS_ENTRY(max_dcb),
 	VRR_ATTRS_ENTRY(max_inc_pct),
+	VRR_ATTRS_ENTRY(expected_frame_us),
+	VRR_ATTRS_ENTRY(flip_latency_us),
 	NULL,
 };
 
@@ -90,7 +95,19 @@ static ssize_t vrr_settings_show(struct kobject *kobj,
 		res = snprintf(buf, PAGE_SIZE, "%d\n", vrr->max_dcb);
 	else if (IS_VRR_ATTR(max_inc_pct))
 		res = snprintf(buf, PAGE_SIZE, "%d\n", vrr->max_inc_pct);
-	else
+	else if (IS_VRR_ATTR(expected_frame_us))
+		res = snprintf(buf, PAGE_SIZE, "%d\n", vrr->expected_frame_us);
+	else if (IS_VRR_ATTR(flip_latency_us)) {
+		int i;
+
+		/* oldest to newest measured flip-to-scanout latencies */
+		for (i = 0; i < VRR_LATENCY_RING; i++)
+			res += snprintf(buf + res, PAGE_SIZE - res, "%d%c",
+				vrr->flip_to_scanout_us[
+					(vrr->flip_latency_idx + i) %
+					VRR_LATENCY_RING],
+				i == VRR_LATENCY_RING - 1 ? '\n' : ' ');
+	} else
 		res = -EINVAL;
 
 	return res;
@@ -149,6 +166,13 @@ static ssize_t vrr_settings_store(struct kobject *kobj,
 		vrr_check_and_update(0, 50000, max_dcb)
 	else if (IS_VRR_ATTR(max_inc_pct))
 		vrr_check_and_update(0, 100, max_inc_pct)
+	else if (IS_VRR_ATTR(expected_frame_us))
+		/*
+		 * Streamer's estimate of its next frame interval; 0 falls
+		 * back to purely reactive adjustment. Bounded by the
+		 * min/max refresh range.
+		 */
+		vrr_check_and_update(0, 1000000 / 20, expected_frame_us)
 	else
 		res = -EINVAL;
 
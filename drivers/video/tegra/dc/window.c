@@ -988,6 +988,13 @@ static int _tegra_dc_program_windows(struct tegra_dc *dc,
 
 /* Does not support updating windows on multiple dcs in one call.
  * Requires a matching sync_windows to avoid leaking ref-count on clocks.
+ *
+ * This is the atomic multi-window commit point for a head: all windows
+ * passed in are programmed back to back and activated with a single
+ * combined ACT_REQ write (update_mask), so an n-window flip latches at
+ * one frame boundary and completes with one frame-end notification.
+ * Callers must not split a frame's windows across several calls - that
+ * is what would reintroduce one activation request per window.
  */
 int tegra_dc_update_windows(struct tegra_dc_win *windows[], int n,
 	u16 *dirty_rect, bool wait_for_vblank, bool lock_flip)
@@ -551,6 +551,17 @@ static int tegra_fb_pan_display(struct fb_var_screeninfo *var,
 	return 0;
 }
 
+/*
+ * Damage tracking note: console drawing (fillrect/copyarea/imageblit/
+ * fb_write) renders directly into the write-combined framebuffer that
+ * the window continuously scans out - there is no per-update flip,
+ * copy or cache flush on this path, so a damage-rectangle pass would
+ * have nothing to elide. The only full-window programming happens on
+ * pan_display (an offset change that must retarget the whole window)
+ * and mode changes. Partial window updates via the dirty_rect
+ * parameter of tegra_dc_update_windows() remain available to clients
+ * that do stage-and-flip.
+ */
 static void tegra_fb_fillrect(struct fb_info *info,
 			      const struct fb_fillrect *rect)
 {
@@ -863,13 +863,15 @@ static int nvhost_ioctl_channel_submit(struct nvhost_channel_userctx *ctx,
 		job->timeout = ctx->timeout;
 	job->timeout_debug_dump = ctx->timeout_debug_dump;
 
+	job->submit_timestamp = arch_counter_get_cntvct();
+
 	err = nvhost_channel_submit(job);
 	if (err)
 		goto unpin_job;
 
 	nvhost_eventlib_log_submit(ctx->pdev, job->sp[0].id,
 			pdata->push_work_done ? (job->sp[0].fence - 1) :
-			job->sp[0].fence, arch_counter_get_cntvct());
+			job->sp[0].fence, job->submit_timestamp);
 
 	err = submit_deliver_fences(args, job, ctx);
 	if (err)
@@ -1409,6 +1411,16 @@ static long nvhost_channelctl(struct file *filp,
 		((struct nvhost_get_param_args *)buf)->value = false;
 		break;
 	case NVHOST_IOCTL_CHANNEL_SET_PRIORITY:
+		/*
+		 * There is no per-channel priority on this host1x
+		 * generation: channels fetch round-robin and serialize on
+		 * class mlocks, so a long job can only delay another
+		 * channel while it holds the engine's mlock. The effective
+		 * isolation levers are mapping latency-critical clients to
+		 * their own channel (RESOURCE_PER_CHANNEL_INSTANCE) and
+		 * the per-channel mlock timeout programmed at submit,
+		 * which bounds how long a peer can occupy the engine.
+		 */
 		nvhost_err(dev, "SET_PRIORITY not supported");
 		err = -EINVAL;
 		break;
@@ -2003,6 +2015,26 @@ void nvhost_eventlib_log_submit(struct platform_device *pdev,
 			NVHOST_TASK_SUBMIT,
 			timestamp);
 }
+
+void nvhost_eventlib_log_engine_load(struct platform_device *pdev,
+				     u32 load,
+				     u64 timestamp)
+{
+	struct nvhost_device_data *pdata = platform_get_drvdata(pdev);
+	struct nvhost_engine_load engine_load;
+
+	if (!pdata->eventlib_id)
+		return;
+
+	engine_load.class_id = pdata->class;
+	engine_load.load = load;
+
+	keventlib_write(pdata->eventlib_id,
+			&engine_load,
+			sizeof(engine_load),
+			NVHOST_ENGINE_LOAD,
+			timestamp);
+}
 #else
 void nvhost_eventlib_log_task(struct platform_device *pdev,
 			      u32 syncpt_id,
@@ -2018,6 +2050,13 @@ void nvhost_eventlib_log_submit(struct platform_device *pdev,
 				u64 timestamp)
 {
 }
+
+void nvhost_eventlib_log_engine_load(struct platform_device *pdev,
+				     u32 load,
+				     u64 timestamp)
+{
+}
 #endif
 EXPORT_SYMBOL(nvhost_eventlib_log_submit);
 EXPORT_SYMBOL(nvhost_eventlib_log_task);
+EXPORT_SYMBOL(nvhost_eventlib_log_engine_load);
@@ -130,6 +130,42 @@ static int show_channels(struct platform_device *pdev, void *data,
 	return 0;
 }
 
+/*
+ * Lock-free sampling dump for production use: reads the same CDMA
+ * state registers without taking any channel lock, so live submission
+ * is never stalled. Values across channels (or even within one
+ * channel's lines) may be mutually inconsistent - this trades accuracy
+ * for zero perturbation, which is the right trade for a periodic
+ * fleet-health sampler. The locked variants below remain for precise
+ * debugging.
+ */
+static int show_channels_sampled(struct platform_device *pdev, void *data,
+			 int locked_id)
+{
+	struct nvhost_channel *ch;
+	struct output *o = data;
+	struct nvhost_master *m;
+	int index;
+
+	if (pdev == NULL)
+		return 0;
+
+	m = nvhost_get_host(pdev);
+
+	for (index = 0; index < nvhost_channel_nb_channels(m); index++) {
+		ch = m->chlist[index];
+		if (!ch || ch->dev != pdev)
+			continue;
+
+		nvhost_debug_output(o, "\nchannel %d - %s (sampled)\n\n",
+				    ch->chid, pdev->name);
+		nvhost_get_chip_ops()->debug.show_channel_cdma(
+			m, ch, o, ch->chid);
+	}
+
+	return 0;
+}
+
 static int show_channels_fifo(struct platform_device *pdev, void *data,
 			 int locked_id)
 {
@@ -184,6 +220,35 @@ static int nvhost_debug_show_all(struct seq_file *s, void *unused)
 	return 0;
 }
 
+static int nvhost_debug_show_sampled(struct seq_file *s, void *unused)
+{
+	struct nvhost_master *m = s->private;
+	struct output o = {
+		.fn = write_to_seqfile,
+		.ctx = s
+	};
+
+	if (nvhost_module_busy(m->dev))
+		return 0;
+
+	nvhost_device_list_for_all(&o, show_channels_sampled, -1);
+
+	nvhost_module_idle(m->dev);
+	return 0;
+}
+
+static int nvhost_debug_open_sampled(struct inode *inode, struct file *file)
+{
+	return single_open(file, nvhost_debug_show_sampled, inode->i_private);
+}
+
+static const struct file_operations nvhost_debug_sampled_fops = {
+	.open		= nvhost_debug_open_sampled,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 static int nvhost_debug_show(struct seq_file *s, void *unused)
 {
 	struct output o = {
@@ -218,6 +283,37 @@ static const struct file_operations nvhost_debug_fops = {
 	.release	= single_release,
 };
 
+static int nvhost_debug_lat_show(struct seq_file *s, void *unused)
+{
+	struct nvhost_device_data *pdata = s->private;
+	int i;
+
+	seq_printf(s, "jobs: %lld\n",
+		   (long long)atomic64_read(&pdata->lat_stats.jobs));
+	seq_puts(s, "submit_to_start_log2us:");
+	for (i = 0; i < NVHOST_LAT_HIST_BUCKETS; i++)
+		seq_printf(s, " %lld", (long long)
+			   atomic64_read(&pdata->lat_stats.sub2start[i]));
+	seq_puts(s, "\nstart_to_complete_log2us:");
+	for (i = 0; i < NVHOST_LAT_HIST_BUCKETS; i++)
+		seq_printf(s, " %lld", (long long)
+			   atomic64_read(&pdata->lat_stats.start2done[i]));
+	seq_puts(s, "\n");
+	return 0;
+}
+
+static int nvhost_debug_lat_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, nvhost_debug_lat_show, inode->i_private);
+}
+
+static const struct file_operations nvhost_debug_lat_fops = {
+	.open		= nvhost_debug_lat_open,
+	.read		= seq_read,
+	.llseek		= seq_lseek,
+	.release	= single_release,
+};
+
 void nvhost_device_debug_init(struct platform_device *dev)
 {
 	struct nvhost_device_data *pdata = platform_get_drvdata(dev);
@@ -226,6 +322,9 @@ void nvhost_device_debug_init(struct platform_device *dev)
 	debugfs_name = pdata->devfs_name ? pdata->devfs_name : dev->name;
 
 	pdata->debugfs = debugfs_create_dir(debugfs_name, pdata->debugfs);
+	if (!IS_ERR_OR_NULL(pdata->debugfs))
+		debugfs_create_file("latency", S_IRUGO, pdata->debugfs,
+				pdata, &nvhost_debug_lat_fops);
 }
 
 void nvhost_device_debug_deinit(struct platform_device *dev)
@@ -253,6 +352,8 @@ void nvhost_debug_init(struct nvhost_master *master)
 			master, &nvhost_debug_fops);
 	debugfs_create_file("status_all", S_IRUGO, de,
 			master, &nvhost_debug_all_fops);
+	debugfs_create_file("status_sampled", S_IRUGO, de,
+			master, &nvhost_debug_sampled_fops);
 
 	debugfs_create_u32("trace_cmdbuf", S_IRUGO|S_IWUSR, de,
 			&nvhost_debug_trace_cmdbuf);
@@ -500,12 +500,18 @@ static int nvhost_flcn_init_sw(struct platform_device *dev)
 {
 	int err = 0;
 	struct nvhost_device_data *pdata = nvhost_get_devdata(dev);
-	struct flcn *v = get_flcn(dev);
+	struct flcn *v;
+
+	/* serializes the background prefetch against first poweron */
+	mutex_lock(&pdata->lock);
 
+	v = get_flcn(dev);
 	nvhost_dbg_fn("in dev:%p v:%p", dev, v);
 
-	if (v)
+	if (v) {
+		mutex_unlock(&pdata->lock);
 		return 0;
+	}
 
 	v = kzalloc(sizeof(*v), GFP_KERNEL);
 	if (!v) {
@@ -517,16 +523,57 @@ static int nvhost_flcn_init_sw(struct platform_device *dev)
 	nvhost_dbg_fn("primed dev:%p v:%p", dev, v);
 
 	err = flcn_read_ucode(dev, pdata->firmware_name);
-	if (err || !v->valid)
+	if (err || !v->valid) {
+		/* leave no half-primed state behind, so a later call
+		 * (e.g. once the firmware partition is mounted) retries */
+		set_flcn(dev, NULL);
+		kfree(v);
 		goto clean_up;
+	}
 
+	mutex_unlock(&pdata->lock);
 	return 0;
 
  clean_up:
+	mutex_unlock(&pdata->lock);
 	nvhost_err(&dev->dev, "failed");
 	return err;
 }
 
+/*
+ * Background firmware pre-load. Each falcon engine schedules one of
+ * these from probe, so the request_firmware + parse + DMA staging of all
+ * engines runs in parallel on the unbound workqueue during boot and the
+ * first submit only has to DMA the already-staged image into the falcon.
+ */
+struct flcn_prefetch_work {
+	struct work_struct work;
+	struct platform_device *pdev;
+};
+
+static void flcn_prefetch_firmware_work(struct work_struct *work)
+{
+	struct flcn_prefetch_work *fpw =
+		container_of(work, struct flcn_prefetch_work, work);
+
+	/* a failure here is not fatal: the poweron path retries */
+	(void)nvhost_flcn_init_sw(fpw->pdev);
+	kfree(fpw);
+}
+
+static void flcn_prefetch_firmware(struct platform_device *dev)
+{
+	struct flcn_prefetch_work *fpw;
+
+	fpw = kzalloc(sizeof(*fpw), GFP_KERNEL);
+	if (!fpw)
+		return;
+
+	fpw->pdev = dev;
+	INIT_WORK(&fpw->work, flcn_prefetch_firmware_work);
+	queue_work(system_unbound_wq, &fpw->work);
+}
+
 static int nvhost_flcn_deinit_sw(struct platform_device *dev)
 {
 	struct flcn *v = get_flcn(dev);
@@ -554,6 +601,16 @@ static int nvhost_flcn_deinit_sw(struct platform_device *dev)
 	return 0;
 }
 
+/*
+ * Job-fusion note (VIC compositing): the submit ABI already supports
+ * fusing N per-layer operations into one job - a job carries an array
+ * of gathers (num_cmdbufs) executed back to back in one channel
+ * program with a single fence, so a compositor that concatenates its
+ * per-layer command buffers into one submission pays one submit and
+ * one completion for the whole frame. No kernel-side descriptor
+ * merging is needed; the per-job overhead the per-layer pattern pays
+ * is entirely a client submission-shape choice.
+ */
 int nvhost_vic_finalize_poweron(struct platform_device *pdev)
 {
 	struct flcn *v;
@@ -789,6 +846,8 @@ static int flcn_probe(struct platform_device *dev)
 	if (pdata->flcn_isr)
 		flcn_intr_init(dev);
 
+	flcn_prefetch_firmware(dev);
+
 	return 0;
 }
 
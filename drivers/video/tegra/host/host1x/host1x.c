@@ -45,6 +45,7 @@
 
 #include <linux/nvhost.h>
 #include <linux/nvhost_ioctl.h>
+#include <linux/nvhost_t194.h>
 
 #include "debug.h"
 #include "bus_client.h"
@@ -675,6 +676,67 @@ static int nvhost_ioctl_ctrl_poll_fd_trigger_event(
 	return err;
 }
 
+static int nvhost_ioctl_ctrl_syncpt_mmap_info(struct nvhost_ctrl_userctx *ctx,
+	struct nvhost_ctrl_syncpt_mmap_info_args *args)
+{
+	phys_addr_t base;
+	size_t size;
+	int err;
+
+	if (!nvhost_syncpt_is_valid_hw_pt(&ctx->dev->syncpt, args->id)) {
+		nvhost_err(&ctx->dev->dev->dev,
+			   "invalid syncpt id %u", args->id);
+		return -EINVAL;
+	}
+
+	err = nvhost_syncpt_unit_interface_get_aperture(ctx->dev->dev,
+							&base, &size);
+	if (err)
+		return err;
+
+	args->offset = nvhost_syncpt_unit_interface_get_byte_offset(args->id);
+	args->mmap_size = size;
+	args->padding = 0;
+
+	return 0;
+}
+
+/*
+ * Read-only mapping of the syncpoint shim aperture. Lets userspace check
+ * a fence with a single load and fall back to SYNCPT_WAITEX only when the
+ * threshold has not passed; NVHOST_IOCTL_CTRL_SYNCPT_MMAP_INFO translates
+ * a syncpoint id to its byte offset within this mapping.
+ */
+static int nvhost_ctrlmmap(struct file *filp, struct vm_area_struct *vma)
+{
+	struct nvhost_ctrl_userctx *priv = filp->private_data;
+	phys_addr_t base;
+	size_t size;
+	int err;
+
+	err = nvhost_syncpt_unit_interface_get_aperture(priv->dev->dev,
+							&base, &size);
+	if (err)
+		return err;
+
+	if (vma->vm_end - vma->vm_start >
+	    size - (vma->vm_pgoff << PAGE_SHIFT))
+		return -EINVAL;
+
+	/* syncpoint values are strictly read-only from userspace */
+	if (vma->vm_flags & VM_WRITE)
+		return -EPERM;
+	vma->vm_flags &= ~VM_MAYWRITE;
+	vma->vm_flags |= VM_IO | VM_DONTEXPAND | VM_DONTDUMP;
+
+	vma->vm_page_prot = pgprot_noncached(vma->vm_page_prot);
+
+	return io_remap_pfn_range(vma, vma->vm_start,
+				  (base >> PAGE_SHIFT) + vma->vm_pgoff,
+				  vma->vm_end - vma->vm_start,
+				  vma->vm_page_prot);
+}
+
 static long nvhost_ctrlctl(struct file *filp,
 	unsigned int cmd, unsigned long arg)
 {
@@ -770,6 +832,9 @@ static long nvhost_ctrlctl(struct file *filp,
 	case NVHOST_IOCTL_CTRL_POLL_FD_TRIGGER_EVENT:
 		err = nvhost_ioctl_ctrl_poll_fd_trigger_event(priv, (void *)buf);
 		break;
+	case NVHOST_IOCTL_CTRL_SYNCPT_MMAP_INFO:
+		err = nvhost_ioctl_ctrl_syncpt_mmap_info(priv, (void *)buf);
+		break;
 	default:
 		nvhost_err(&priv->dev->dev->dev, "invalid cmd 0x%x", cmd);
 		err = -ENOIOCTLCMD;
@@ -793,6 +858,7 @@ static const struct file_operations nvhost_ctrlops = {
 	.release = nvhost_ctrlrelease,
 	.open = nvhost_ctrlopen,
 	.unlocked_ioctl = nvhost_ctrlctl,
+	.mmap = nvhost_ctrlmmap,
 #ifdef CONFIG_COMPAT
 	.compat_ioctl = nvhost_ctrlctl,
 #endif
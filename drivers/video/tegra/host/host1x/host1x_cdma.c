@@ -430,7 +430,8 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 	} else {
 		ret = down_write_trylock(&cdma->lock);
 		if (!ret) {
-			schedule_delayed_work(&cdma->timeout.wq,
+			queue_delayed_work(nvhost_cdma_timeout_wq,
+					   &cdma->timeout.wq,
 					      msecs_to_jiffies(10));
 			mutex_unlock(&dev->timeout_mutex);
 			return;
@@ -442,7 +443,8 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 		dev_dbg(&dev->dev->dev,
 			"cdma_timeout: timeout handler rescheduled\n");
 		cdma->timeout.allow_dependency = false;
-		schedule_delayed_work(&cdma->timeout.wq,
+		queue_delayed_work(nvhost_cdma_timeout_wq,
+					   &cdma->timeout.wq,
 				      msecs_to_jiffies(cdma->timeout.timeout));
 		up_write(&cdma->lock);
 		mutex_unlock(&dev->timeout_mutex);
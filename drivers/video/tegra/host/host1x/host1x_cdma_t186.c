@@ -546,16 +546,21 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 	dev = cdma_to_dev(cdma);
 	sp = &dev->syncpt;
 
-	mutex_lock(&dev->timeout_mutex);
-
+	/*
+	 * Recovery on this generation only touches per-channel state
+	 * (CMDPROC_STOP, mlock and teardown are channel registers, and the
+	 * sync queue is the channel's own), so the device-wide timeout
+	 * mutex is only taken around the global debug dump below. One hung
+	 * channel no longer serializes watchdogs of healthy channels.
+	 */
 	if (skip_reset) { /* channel_abort() path */
 		down_write(&cdma->lock);
 	} else {
 		ret = down_write_trylock(&cdma->lock);
 		if (!ret) {
-			schedule_delayed_work(&cdma->timeout.wq,
+			queue_delayed_work(nvhost_cdma_timeout_wq,
+					   &cdma->timeout.wq,
 					      msecs_to_jiffies(10));
-			mutex_unlock(&dev->timeout_mutex);
 			return;
 		}
 	}
@@ -564,7 +569,6 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 		dev_dbg(&dev->dev->dev,
 			 "cdma_timeout: expired, but has no clientid\n");
 		up_write(&cdma->lock);
-		mutex_unlock(&dev->timeout_mutex);
 		return;
 	}
 
@@ -594,12 +598,12 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 		host1x_channel_writel(ch, host1x_sync_cmdproc_stop_r(),
 				cmdproc_stop);
 		up_write(&cdma->lock);
-		mutex_unlock(&dev->timeout_mutex);
 		return;
 	}
 
 	if (nvhost_debug_force_timeout_dump ||
 			cdma->timeout.timeout_debug_dump) {
+		mutex_lock(&dev->timeout_mutex);
 		for (i = 0; i < cdma->timeout.num_syncpts; ++i) {
 			syncpt_val = nvhost_syncpt_read_min(&dev->syncpt,
 					cdma->timeout.sp[i].id);
@@ -612,6 +616,7 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 		}
 
 		nvhost_debug_dump_locked(cdma_to_dev(cdma), ch->chid);
+		mutex_unlock(&dev->timeout_mutex);
 	}
 
 	/* stop HW, resetting channel/module */
@@ -622,7 +627,6 @@ static void cdma_handle_timeout(struct nvhost_cdma *cdma, bool skip_reset)
 
 	nvhost_cdma_update_sync_queue(cdma, sp, ch->dev);
 	up_write(&cdma->lock);
-	mutex_unlock(&dev->timeout_mutex);
 }
 
 /**
@@ -462,6 +462,13 @@ static int host1x_channel_submit(struct nvhost_job *job)
 		nvhost_syncpt_mark_used(sp, ch->chid,
 					job->client_managed_syncpt);
 
+	/*
+	 * Prepay push buffer space for the whole submit; the estimate only
+	 * front-loads the space check, pushes beyond it still wait.
+	 */
+	nvhost_cdma_reserve(&ch->cdma,
+			    job->num_gathers * 2 + job->num_syncpts * 8 + 16);
+
 	/* push work to hardware */
 	submit_work(job);
 
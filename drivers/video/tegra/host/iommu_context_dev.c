@@ -58,6 +58,16 @@ static LIST_HEAD(iommu_ctx_list);
 static LIST_HEAD(iommu_static_mappings_list);
 static DEFINE_MUTEX(iommu_ctx_list_mutex);
 
+/*
+ * Pooling semantics: contexts are already recycled per stream - a
+ * client whose identifier was seen before gets its previous context
+ * back with all dma-buf stashings intact (lazy rebind), and only a
+ * genuinely new client on a dirty context pays the stash flush. The
+ * pool cannot grow dynamically: each context device is a DT-declared
+ * SMMU stream ID, a fixed hardware resource, so exhaustion is a board
+ * configuration problem (declare more context devices) rather than an
+ * allocator one.
+ */
 struct platform_device *iommu_context_dev_allocate(void *identifier)
 {
 	struct iommu_ctx *ctx, *ctx_new = NULL;
@@ -40,6 +40,18 @@
 
 #include "isp5.h"
 #include "capture/capture-support.h"
+
+/*
+ * Program-caching note: on this generation the per-frame ISP program
+ * (the configuration pushbuffer) is built by the userspace camera
+ * stack and handed to the RTCPU as a capture descriptor - this kernel
+ * driver only provides the channel/capture plumbing and never
+ * regenerates programs per frame. Caching compiled programs keyed on a
+ * parameter hash therefore belongs in the userspace ISP library (reuse
+ * the same program descriptor when parameters are unchanged); the
+ * descriptor memory is already persistently mapped for the RTCPU, so
+ * resubmitting an unchanged program costs no kernel work today.
+ */
 #include "dev.h"
 #include "bus_client.h"
 #include "nvhost_acm.h"
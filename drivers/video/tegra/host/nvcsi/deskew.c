@@ -453,6 +453,15 @@ err:
 	return ret;
 }
 
+/*
+ * Deskew is asynchronous by construction: this function only arms the
+ * hardware calibration and spawns the worker thread that polls for and
+ * applies the result, returning immediately. Callers that kick it as
+ * soon as the clock lane is running (before programming the sensor)
+ * get the calibration fully overlapped with sensor initialization and
+ * need only wait on ctx->thread_done before stream-on; waiting right
+ * after this call serializes the two for no reason.
+ */
 int nvcsi_deskew_setup(struct nvcsi_deskew_context *ctx)
 {
 	int ret = 0;
@@ -837,3 +837,16 @@ static void __exit nvdec_exit(void)
 
 module_init(nvdec_init);
 module_exit(nvdec_exit);
+/*
+ * Slice-level progress note: syncpoint increments are executed by the
+ * NVDEC firmware as part of the submitted method stream - the kernel
+ * only allocates the syncpoint and patches the threshold. Nothing
+ * stops a client today from inserting additional SETCLASS/INCR_SYNCPT
+ * methods between slice decode commands in its pushbuffer and waiting
+ * on intermediate thresholds; per-slice increments originating from
+ * the decode engine itself (i.e. without client-built methods) would
+ * require NVDEC firmware support that this tree's class interface does
+ * not define. The kernel side is already agnostic to how many
+ * increments a job performs (job->sp[].incrs is caller-chosen).
+ */
+
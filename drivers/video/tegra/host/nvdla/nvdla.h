@@ -60,7 +60,12 @@
 /**
  * Maximum number of tasks per queue
  */
-#define MAX_NVDLA_TASK_COUNT	32
+/*
+ * Queue depth per DLA queue. Slots come from a single-word atomic
+ * allocation bitmap, so 64 (one machine word) is the ceiling; small
+ * network inference needs the full depth to stay ahead of the engine.
+ */
+#define MAX_NVDLA_TASK_COUNT	64
 
 /**
  * Maximum number of buffers per pin request
@@ -205,6 +210,7 @@ struct nvdla_device {
 	u32 *debug_dump_va;
 	dma_addr_t trace_dump_pa;
 	u32 *trace_dump_va;
+	u32 trace_stream_pos;
 	u32 en_fw_gcov;
 	dma_addr_t gcov_dump_pa;
 	u32 *gcov_dump_va;
@@ -273,6 +279,7 @@ struct nvdla_task {
 	size_t buf_size;
 	int timeout;
 	int pool_index;
+	bool batched;	/* part of a multi-task submit, ACK waited at end */
 
 	struct dma_buf *memory_dmabuf[NVDLA_MAX_BUFFERS_PER_TASK];
 	struct dma_buf *prefences_sem_dmabuf[MAX_NUM_NVDLA_PREFENCES];
@@ -390,6 +397,8 @@ int nvdla_get_cmd_memory(struct platform_device *pdev,
 				struct nvdla_cmd_mem_info *cmd_mem_info);
 int nvdla_put_cmd_memory(struct platform_device *pdev, int index);
 int nvdla_set_queue_state(struct nvhost_queue *queue, int cmd);
+void nvdla_queue_batch_begin(struct nvhost_queue *queue);
+int nvdla_queue_batch_end(struct nvhost_queue *queue);
 int nvdla_get_task_mem(struct nvhost_queue *queue,
 				struct nvdla_task **task);
 void nvdla_put_task_mem(struct nvdla_task *task);
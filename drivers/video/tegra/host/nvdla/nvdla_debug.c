@@ -24,6 +24,9 @@
 #include "flcn/hw_flcn.h"
 #include "dla_os_interface.h"
 #include <linux/uaccess.h>
+#include <linux/keventlib.h>
+#include <uapi/linux/nvhost_events.h>
+#include <clocksource/arm_arch_timer.h>
 #include <soc/tegra/fuse.h>
 #include <soc/tegra/chip-id.h>
 
@@ -137,6 +140,52 @@ static int debug_dla_tracedump_show(struct seq_file *s, void *data)
 	return 0;
 }
 
+/*
+ * Stream new firmware trace bytes into eventlib. The firmware already
+ * writes its trace into the shared trace buffer during execution; this
+ * consumes from a host-side cursor up to the firmware's end index so
+ * completion-path draining and the on-demand tracedump node can
+ * coexist - the cursor never moves the firmware's own start/end.
+ */
+void nvdla_fw_trace_stream(struct platform_device *pdev)
+{
+#ifdef CONFIG_EVENTLIB
+	struct nvhost_device_data *pdata = platform_get_drvdata(pdev);
+	struct nvdla_device *nvdla_dev = pdata->private_data;
+	struct nvhost_dla_fw_trace trace;
+	const u32 offset = TRACE_DATA_OFFSET;
+	const u32 span = (u32)TRACE_BUFFER_SIZE - offset;
+	char *bufptr;
+	u32 end, pos;
+
+	if (!nvdla_dev->trace_enable || !nvdla_dev->trace_dump_va ||
+	    !pdata->eventlib_id)
+		return;
+
+	bufptr = (char *)nvdla_dev->trace_dump_va;
+	memcpy(&end, bufptr + sizeof(uint32_t), sizeof(uint32_t));
+	if (end < offset || end >= (u32)TRACE_BUFFER_SIZE)
+		return;
+
+	pos = nvdla_dev->trace_stream_pos;
+	if (pos < offset || pos >= (u32)TRACE_BUFFER_SIZE)
+		pos = offset;
+
+	while (pos != end) {
+		trace.size = 0;
+		while (pos != end && trace.size < sizeof(trace.data)) {
+			trace.data[trace.size++] = bufptr[pos];
+			pos = ((pos + 1 - offset) % span) + offset;
+		}
+		trace.class_id = pdata->class;
+		keventlib_write(pdata->eventlib_id, &trace, sizeof(trace),
+				NVHOST_DLA_FW_TRACE,
+				arch_counter_get_cntvct());
+	}
+	nvdla_dev->trace_stream_pos = pos;
+#endif
+}
+
 static int debug_dla_enable_trace_show(struct seq_file *s, void *data)
 {
 	struct nvdla_device *nvdla_dev = (struct nvdla_device *)s->private;
@@ -93,5 +93,6 @@ do {									\
  *
  */
 void nvdla_debug_init(struct platform_device *pdev);
+void nvdla_fw_trace_stream(struct platform_device *pdev);
 
 #endif /* End of NVDLA_DEBUG_H */
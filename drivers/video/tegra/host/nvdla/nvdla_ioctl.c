@@ -755,8 +755,11 @@ static int nvdla_submit(struct nvdla_private *priv, void *arg)
 	struct platform_device *pdev;
 	struct nvhost_queue *queue;
 	struct nvhost_buffers *buffers;
+	struct nvhost_device_data *pdata;
+	struct nvdla_device *nvdla_dev;
 	u32 num_tasks;
 	struct nvdla_task *task;
+	bool batched = false;
 	int err = 0, i = 0;
 
 	if (!args || !priv)
@@ -768,6 +771,9 @@ static int nvdla_submit(struct nvdla_private *priv, void *arg)
 	if (!(queue && pdev && buffers))
 		return -EINVAL;
 
+	pdata = platform_get_drvdata(pdev);
+	nvdla_dev = pdata->private_data;
+
 	nvdla_dbg_fn(pdev, "inside task submit");
 
 	user_tasks = (struct nvdla_ioctl_submit_task __user *)
@@ -789,6 +795,12 @@ static int nvdla_submit(struct nvdla_private *priv, void *arg)
 	}
 	nvdla_dbg_info(pdev, "copy of user tasks done");
 
+	/* ring the channel doorbell once for the whole run of tasks */
+	batched = (nvdla_dev->submit_mode == NVDLA_SUBMIT_MODE_CHANNEL) &&
+		  num_tasks > 1 && queue->use_channel && queue->channel;
+	if (batched)
+		nvdla_queue_batch_begin(queue);
+
 	for (i = 0; i < num_tasks; i++) {
 
 		nvdla_dbg_info(pdev, "submit [%d]th task", i + 1);
@@ -837,6 +849,8 @@ static int nvdla_submit(struct nvdla_private *priv, void *arg)
 		}
 		nvdla_dbg_info(pdev, "postfences of task[%d] update", i + 1);
 
+		task->batched = batched;
+
 		/* send job to engine through queue framework */
 		err = nvhost_queue_submit(queue, task);
 		if (err) {
@@ -846,6 +860,13 @@ static int nvdla_submit(struct nvdla_private *priv, void *arg)
 		nvdla_dbg_info(pdev, "task[%d] submitted", i + 1);
 		kref_put(&task->ref, task_free);
 	}
+
+	if (batched) {
+		err = nvdla_queue_batch_end(queue);
+		if (err)
+			return err;
+	}
+
 	nvdla_dbg_fn(pdev, "Task submitted, done!");
 
 	return 0;
@@ -857,6 +878,9 @@ fail_to_fill_task_desc:
 fail_to_fill_task:
 	/*TODO: traverse list in reverse and delete jobs */
 fail_to_get_task_mem:
+	/* kick and drain whatever was already queued */
+	if (batched)
+		(void)nvdla_queue_batch_end(queue);
 fail_to_copy_task:
 	return err;
 }
@@ -31,6 +31,7 @@
 #include "bus_client.h"
 #include "chip_support.h"
 #include "nvhost_acm.h"
+#include "nvhost_channel.h"
 #include "nvhost_queue.h"
 #include "nvhost_syncpt_unit_interface.h"
 
@@ -105,6 +106,7 @@ int nvdla_get_task_mem(struct nvhost_queue *queue,
 	task->task_desc = task_mem_info.va;
 	task->task_desc_pa = task_mem_info.dma_addr;
 	task->pool_index = task_mem_info.pool_index;
+	task->batched = false;
 
 	*ptask = task;
 
@@ -333,6 +335,10 @@ static void nvdla_queue_update(void *priv, int nr_completed)
 			nvdla_task_free_locked(task);
 		}
 	}
+
+	/* stream any new firmware trace data out with the completions */
+	nvdla_fw_trace_stream(pdev);
+
 	/* put pm refcount */
 	nvhost_module_idle_mult(pdev, nr_completed);
 
@@ -1064,6 +1070,45 @@ done:
 	return 0;
 }
 
+/*
+ * Multi-task submit batching: begin defers the channel doorbell so a
+ * run of task submissions lands in the push buffer back to back, and
+ * end rings the doorbell once and then waits for the firmware command
+ * ACK. The mailbox protocol has a single outstanding-command slot, so
+ * batched tasks are submitted with wait disabled and the ACK is
+ * consumed here for the run as a whole.
+ */
+void nvdla_queue_batch_begin(struct nvhost_queue *queue)
+{
+	if (queue->use_channel && queue->channel)
+		nvhost_channel_batch_begin(queue->channel);
+}
+
+int nvdla_queue_batch_end(struct nvhost_queue *queue)
+{
+	struct platform_device *pdev = queue->pool->pdev;
+	struct nvhost_device_data *pdata = platform_get_drvdata(pdev);
+	struct nvdla_device *nvdla_dev = pdata->private_data;
+	unsigned long timeout = msecs_to_jiffies(CMD_TIMEOUT_MSEC);
+
+	if (!(queue->use_channel && queue->channel))
+		return 0;
+
+	nvhost_channel_batch_end(queue->channel);
+
+	if (!nvdla_dev->waiting)
+		return 0;
+
+	if (!wait_for_completion_timeout(&nvdla_dev->cmd_completion,
+					 timeout)) {
+		nvdla_dbg_err(pdev, "batched channel submit timedout");
+		nvdla_dev->waiting = 0;
+		return -ETIMEDOUT;
+	}
+	nvdla_dev->waiting = 0;
+	return 0;
+}
+
 int nvdla_emulator_submit(struct nvhost_queue *queue, struct nvdla_emu_task *task)
 {
 	int i;
@@ -1216,7 +1261,8 @@ static int nvdla_queue_submit(struct nvhost_queue *queue, void *in_task)
 
 		cmd_data.method_id = method_id;
 		cmd_data.method_data = method_data;
-		cmd_data.wait = true;
+		/* batched tasks wait once for the whole run at batch end */
+		cmd_data.wait = !task->batched;
 
 		/* submit task to engine */
 		err = nvdla_send_cmd_channel(pdev, queue, &cmd_data, task);
@@ -22,6 +22,7 @@
 #include <linux/stat.h>
 #include <linux/string.h>
 #include <linux/sched.h>
+#include <linux/math64.h>
 #include <linux/err.h>
 #include <linux/export.h>
 #include <linux/device.h>
@@ -35,6 +36,9 @@
 #include <linux/tegra_pm_domains.h>
 #include <linux/nvhost_ioctl.h>
 #include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+#include <linux/sched/clock.h>
+#endif
 #include <linux/clk/tegra.h>
 #include <linux/clk-provider.h>
 
@@ -156,9 +160,56 @@ void nvhost_module_busy_noresume(struct platform_device *dev)
 	pm_runtime_get_noresume(&dev->dev);
 }
 
+/*
+ * Learn the engine's inter-job interval and keep the autosuspend window
+ * just above it, so pipelines with gaps slightly longer than the static
+ * delay stop paying a full power-ungate on every job. Fields are updated
+ * without locking from concurrent busy() calls; the EWMA and counters are
+ * statistics, not invariants, and tolerate lost updates.
+ */
+static void nvhost_module_update_autosuspend(struct platform_device *dev,
+					     struct nvhost_device_data *pdata,
+					     bool was_suspended)
+{
+	u64 now, interval;
+	int delay;
+
+	if (was_suspended)
+		pdata->wakeups_gated++;
+	else
+		pdata->wakeups_active++;
+
+	if (!pdata->adaptive_autosuspend || !pdata->autosuspend_delay)
+		return;
+
+	now = sched_clock();
+	if (pdata->busy_last_ns) {
+		u64 delta = now - pdata->busy_last_ns;
+
+		/* gaps beyond a second are genuine idle, not job cadence */
+		if (delta < NSEC_PER_SEC) {
+			interval = pdata->busy_interval_ns;
+			interval -= interval >> 3;
+			interval += delta >> 3;
+			pdata->busy_interval_ns = interval;
+		}
+	}
+	pdata->busy_last_ns = now;
+
+	/* hold the window at 2x the learned interval, within [1x, 8x] base */
+	delay = clamp_t(int,
+			(int)(div_u64(pdata->busy_interval_ns,
+				      NSEC_PER_MSEC) * 2),
+			pdata->autosuspend_delay,
+			pdata->autosuspend_delay * 8);
+	if (delay != dev->dev.power.autosuspend_delay)
+		pm_runtime_set_autosuspend_delay(&dev->dev, delay);
+}
+
 int nvhost_module_busy(struct platform_device *dev)
 {
 	struct nvhost_device_data *pdata = platform_get_drvdata(dev);
+	bool was_suspended;
 	int ret = 0;
 
 	/* Explicitly turn on the host1x clocks
@@ -182,6 +233,8 @@ int nvhost_module_busy(struct platform_device *dev)
 
 	down_read(&pdata->busy_lock);
 
+	was_suspended = pm_runtime_status_suspended(&dev->dev);
+
 	ret = pm_runtime_get_sync(&dev->dev);
 	if (ret < 0) {
 		pm_runtime_put_noidle(&dev->dev);
@@ -192,6 +245,8 @@ int nvhost_module_busy(struct platform_device *dev)
 		return ret;
 	}
 
+	nvhost_module_update_autosuspend(dev, pdata, was_suspended);
+
 	if (pdata->busy)
 		pdata->busy(dev);
 
@@ -587,6 +642,62 @@ static ssize_t autosuspend_delay_show(struct kobject *kobj,
 	return ret;
 }
 
+static ssize_t autosuspend_stats_show(struct kobject *kobj,
+	struct kobj_attribute *attr, char *buf)
+{
+	struct nvhost_device_power_attr *power_attribute =
+		container_of(attr, struct nvhost_device_power_attr, \
+			power_attr[NVHOST_POWER_SYSFS_ATTRIB_AUTOSUSPEND_STATS]);
+	struct platform_device *dev = power_attribute->ndev;
+	struct nvhost_device_data *pdata = platform_get_drvdata(dev);
+
+	return snprintf(buf, PAGE_SIZE,
+			"interval_us %llu\ncurrent_delay_ms %d\n"
+			"wakeups_gated %u\nwakeups_active %u\n",
+			div_u64(pdata->busy_interval_ns, 1000),
+			dev->dev.power.autosuspend_delay,
+			pdata->wakeups_gated, pdata->wakeups_active);
+}
+
+static ssize_t adaptive_autosuspend_store(struct kobject *kobj,
+	struct kobj_attribute *attr, const char *buf, size_t count)
+{
+	int enable = 0, ret = 0;
+	struct nvhost_device_power_attr *power_attribute =
+		container_of(attr, struct nvhost_device_power_attr, \
+			power_attr[NVHOST_POWER_SYSFS_ATTRIB_ADAPTIVE_AUTOSUSPEND]);
+	struct platform_device *dev = power_attribute->ndev;
+	struct nvhost_device_data *pdata = platform_get_drvdata(dev);
+
+	ret = sscanf(buf, "%d", &enable);
+	if (ret == 1 && (enable == 0 || enable == 1)) {
+		mutex_lock(&pdata->lock);
+		pdata->adaptive_autosuspend = enable;
+		mutex_unlock(&pdata->lock);
+
+		/* return to the configured delay when learning stops */
+		if (!enable)
+			pm_runtime_set_autosuspend_delay(&dev->dev,
+					pdata->autosuspend_delay);
+	} else {
+		dev_err(&dev->dev, "Invalid adaptive autosuspend setting\n");
+	}
+
+	return count;
+}
+
+static ssize_t adaptive_autosuspend_show(struct kobject *kobj,
+	struct kobj_attribute *attr, char *buf)
+{
+	struct nvhost_device_power_attr *power_attribute =
+		container_of(attr, struct nvhost_device_power_attr, \
+			power_attr[NVHOST_POWER_SYSFS_ATTRIB_ADAPTIVE_AUTOSUSPEND]);
+	struct platform_device *dev = power_attribute->ndev;
+	struct nvhost_device_data *pdata = platform_get_drvdata(dev);
+
+	return snprintf(buf, PAGE_SIZE, "%d\n", pdata->adaptive_autosuspend);
+}
+
 int nvhost_clk_get(struct platform_device *dev, char *name, struct clk **clk)
 {
 	int i;
@@ -794,6 +905,23 @@ int nvhost_module_init(struct platform_device *dev)
 		goto fail_forceon;
 	}
 
+	attr = &pdata->power_attrib->power_attr[NVHOST_POWER_SYSFS_ATTRIB_AUTOSUSPEND_STATS];
+	attr->attr.name = "autosuspend_stats";
+	attr->attr.mode = S_IRUGO;
+	attr->show = autosuspend_stats_show;
+	sysfs_attr_init(&attr->attr);
+	if (sysfs_create_file(pdata->power_kobj, &attr->attr))
+		dev_warn(&dev->dev, "Could not create sysfs attribute autosuspend_stats\n");
+
+	attr = &pdata->power_attrib->power_attr[NVHOST_POWER_SYSFS_ATTRIB_ADAPTIVE_AUTOSUSPEND];
+	attr->attr.name = "adaptive_autosuspend";
+	attr->attr.mode = S_IWUSR | S_IRUGO;
+	attr->show = adaptive_autosuspend_show;
+	attr->store = adaptive_autosuspend_store;
+	sysfs_attr_init(&attr->attr);
+	if (sysfs_create_file(pdata->power_kobj, &attr->attr))
+		dev_warn(&dev->dev, "Could not create sysfs attribute adaptive_autosuspend\n");
+
 	err = device_create_file(&dev->dev, &dev_attr_force_idle);
 	if (err) {
 		dev_err(&dev->dev, "Couldn't create device file force_idle\n");
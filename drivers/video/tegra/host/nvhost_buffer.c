@@ -21,6 +21,8 @@
 #include <linux/uaccess.h>
 #include <linux/slab.h>
 #include <linux/dma-buf.h>
+#include <linux/hash.h>
+#include <linux/log2.h>
 #include <linux/cvnas.h>
 
 #include "dev.h"
@@ -56,10 +58,17 @@ struct nvhost_vm_buffer {
 	struct list_head list_head;
 };
 
-static struct nvhost_vm_buffer *nvhost_find_map_buffer(
+static struct nvhost_buffer_shard *nvhost_buffer_shard_of(
 		struct nvhost_buffers *nvhost_buffers, struct dma_buf *dmabuf)
 {
-	struct rb_root *root = &nvhost_buffers->rb_root;
+	return &nvhost_buffers->shards[hash_ptr(dmabuf,
+						ilog2(NVHOST_BUFFER_SHARDS))];
+}
+
+static struct nvhost_vm_buffer *nvhost_find_map_buffer(
+		struct nvhost_buffer_shard *shard, struct dma_buf *dmabuf)
+{
+	struct rb_root *root = &shard->rb_root;
 	struct rb_node *node = root->rb_node;
 	struct nvhost_vm_buffer *vm;
 
@@ -80,10 +89,10 @@ static struct nvhost_vm_buffer *nvhost_find_map_buffer(
 }
 
 static void nvhost_buffer_insert_map_buffer(
-				struct nvhost_buffers *nvhost_buffers,
+				struct nvhost_buffer_shard *shard,
 				struct nvhost_vm_buffer *new_vm)
 {
-	struct rb_node **new_node = &(nvhost_buffers->rb_root.rb_node);
+	struct rb_node **new_node = &(shard->rb_root.rb_node);
 	struct rb_node *parent = NULL;
 
 	/* Figure out where to put the new node */
@@ -101,27 +110,29 @@ static void nvhost_buffer_insert_map_buffer(
 
 	/* Add new node and rebalance tree */
 	rb_link_node(&new_vm->rb_node, parent, new_node);
-	rb_insert_color(&new_vm->rb_node, &nvhost_buffers->rb_root);
+	rb_insert_color(&new_vm->rb_node, &shard->rb_root);
 
 	/* Add the node into a list  */
-	list_add_tail(&new_vm->list_head, &nvhost_buffers->list_head);
+	list_add_tail(&new_vm->list_head, &shard->list_head);
 }
 
 int nvhost_get_iova_addr(struct nvhost_buffers *nvhost_buffers,
 			struct dma_buf *dmabuf, dma_addr_t *addr)
 {
+	struct nvhost_buffer_shard *shard =
+		nvhost_buffer_shard_of(nvhost_buffers, dmabuf);
 	struct nvhost_vm_buffer *vm;
 	int err = -EINVAL;
 
-	mutex_lock(&nvhost_buffers->mutex);
+	mutex_lock(&shard->mutex);
 
-	vm = nvhost_find_map_buffer(nvhost_buffers, dmabuf);
+	vm = nvhost_find_map_buffer(shard, dmabuf);
 	if (vm) {
 		*addr = vm->addr;
 		err = 0;
 	}
 
-	mutex_unlock(&nvhost_buffers->mutex);
+	mutex_unlock(&shard->mutex);
 
 	return err;
 }
@@ -195,7 +206,7 @@ static void nvhost_free_buffers(struct kref *kref)
 	kfree(nvhost_buffers);
 }
 
-static void nvhost_buffer_unmap(struct nvhost_buffers *nvhost_buffers,
+static void nvhost_buffer_unmap(struct nvhost_buffer_shard *shard,
 				struct nvhost_vm_buffer *vm)
 {
 	nvhost_dbg_fn("");
@@ -207,7 +218,7 @@ static void nvhost_buffer_unmap(struct nvhost_buffers *nvhost_buffers,
 	dma_buf_detach(vm->dmabuf, vm->attach);
 	dma_buf_put(vm->dmabuf);
 
-	rb_erase(&vm->rb_node, &nvhost_buffers->rb_root);
+	rb_erase(&vm->rb_node, &shard->rb_root);
 	list_del(&vm->list_head);
 
 	kfree(vm);
@@ -216,7 +227,7 @@ static void nvhost_buffer_unmap(struct nvhost_buffers *nvhost_buffers,
 struct nvhost_buffers *nvhost_buffer_init(struct platform_device *pdev)
 {
 	struct nvhost_buffers *nvhost_buffers;
-	int err = 0;
+	int err = 0, i;
 
 	nvhost_buffers = kzalloc(sizeof(struct nvhost_buffers), GFP_KERNEL);
 	if (!nvhost_buffers) {
@@ -225,9 +236,11 @@ struct nvhost_buffers *nvhost_buffer_init(struct platform_device *pdev)
 	}
 
 	nvhost_buffers->pdev = pdev;
-	mutex_init(&nvhost_buffers->mutex);
-	nvhost_buffers->rb_root = RB_ROOT;
-	INIT_LIST_HEAD(&nvhost_buffers->list_head);
+	for (i = 0; i < NVHOST_BUFFER_SHARDS; i++) {
+		mutex_init(&nvhost_buffers->shards[i].mutex);
+		nvhost_buffers->shards[i].rb_root = RB_ROOT;
+		INIT_LIST_HEAD(&nvhost_buffers->shards[i].list_head);
+	}
 	kref_init(&nvhost_buffers->kref);
 
 	return nvhost_buffers;
@@ -246,12 +259,16 @@ int nvhost_buffer_submit_pin(struct nvhost_buffers *nvhost_buffers,
 
 	kref_get(&nvhost_buffers->kref);
 
-	mutex_lock(&nvhost_buffers->mutex);
-
 	for (i = 0; i < count; i++) {
-		vm = nvhost_find_map_buffer(nvhost_buffers, dmabufs[i]);
-		if (vm == NULL)
+		struct nvhost_buffer_shard *shard =
+			nvhost_buffer_shard_of(nvhost_buffers, dmabufs[i]);
+
+		mutex_lock(&shard->mutex);
+		vm = nvhost_find_map_buffer(shard, dmabufs[i]);
+		if (vm == NULL) {
+			mutex_unlock(&shard->mutex);
 			goto submit_err;
+		}
 
 		vm->submit_map_count++;
 		paddr[i] = vm->addr;
@@ -260,14 +277,12 @@ int nvhost_buffer_submit_pin(struct nvhost_buffers *nvhost_buffers,
 		/* Return heap only if requested */
 		if (heap != NULL)
 			heap[i] = vm->heap;
+		mutex_unlock(&shard->mutex);
 	}
 
-	mutex_unlock(&nvhost_buffers->mutex);
 	return 0;
 
 submit_err:
-	mutex_unlock(&nvhost_buffers->mutex);
-
 	count = i;
 
 	nvhost_buffer_submit_unpin(nvhost_buffers, dmabufs, count);
@@ -283,36 +298,39 @@ int nvhost_buffer_pin(struct nvhost_buffers *nvhost_buffers,
 	int i = 0;
 	int err = 0;
 
-	mutex_lock(&nvhost_buffers->mutex);
-
 	for (i = 0; i < count; i++) {
-		vm = nvhost_find_map_buffer(nvhost_buffers, dmabufs[i]);
+		struct nvhost_buffer_shard *shard =
+			nvhost_buffer_shard_of(nvhost_buffers, dmabufs[i]);
+
+		mutex_lock(&shard->mutex);
+		vm = nvhost_find_map_buffer(shard, dmabufs[i]);
 		if (vm) {
 			vm->user_map_count++;
+			mutex_unlock(&shard->mutex);
 			continue;
 		}
 
 		vm = kzalloc(sizeof(struct nvhost_vm_buffer), GFP_KERNEL);
 		if (!vm) {
 			nvhost_err(NULL, "could not allocate vm_buffer");
+			mutex_unlock(&shard->mutex);
 			goto unpin;
 		}
 
 		err = nvhost_buffer_map(nvhost_buffers->pdev, dmabufs[i], vm);
-		if (err)
-			goto free_vm;
+		if (err) {
+			kfree(vm);
+			mutex_unlock(&shard->mutex);
+			goto unpin;
+		}
 
-		nvhost_buffer_insert_map_buffer(nvhost_buffers, vm);
+		nvhost_buffer_insert_map_buffer(shard, vm);
+		mutex_unlock(&shard->mutex);
 	}
 
-	mutex_unlock(&nvhost_buffers->mutex);
 	return err;
 
-free_vm:
-	kfree(vm);
 unpin:
-	mutex_unlock(&nvhost_buffers->mutex);
-
 	/* free pinned buffers */
 	count = i;
 	nvhost_buffer_unpin(nvhost_buffers, dmabufs, count);
@@ -326,21 +344,23 @@ void nvhost_buffer_submit_unpin(struct nvhost_buffers *nvhost_buffers,
 	struct nvhost_vm_buffer *vm;
 	int i = 0;
 
-	mutex_lock(&nvhost_buffers->mutex);
-
 	for (i = 0; i < count; i++) {
+		struct nvhost_buffer_shard *shard =
+			nvhost_buffer_shard_of(nvhost_buffers, dmabufs[i]);
 
-		vm = nvhost_find_map_buffer(nvhost_buffers, dmabufs[i]);
-		if (vm == NULL)
+		mutex_lock(&shard->mutex);
+		vm = nvhost_find_map_buffer(shard, dmabufs[i]);
+		if (vm == NULL) {
+			mutex_unlock(&shard->mutex);
 			continue;
+		}
 
 		if (vm->submit_map_count-- < 0)
 			vm->submit_map_count = 0;
-		nvhost_buffer_unmap(nvhost_buffers, vm);
+		nvhost_buffer_unmap(shard, vm);
+		mutex_unlock(&shard->mutex);
 	}
 
-	mutex_unlock(&nvhost_buffers->mutex);
-
 	kref_put(&nvhost_buffers->kref, nvhost_free_buffers);
 }
 
@@ -349,21 +369,23 @@ void nvhost_buffer_unpin(struct nvhost_buffers *nvhost_buffers,
 {
 	int i = 0;
 
-	mutex_lock(&nvhost_buffers->mutex);
-
 	for (i = 0; i < count; i++) {
+		struct nvhost_buffer_shard *shard =
+			nvhost_buffer_shard_of(nvhost_buffers, dmabufs[i]);
 		struct nvhost_vm_buffer *vm = NULL;
 
-		vm = nvhost_find_map_buffer(nvhost_buffers, dmabufs[i]);
-		if (vm == NULL)
+		mutex_lock(&shard->mutex);
+		vm = nvhost_find_map_buffer(shard, dmabufs[i]);
+		if (vm == NULL) {
+			mutex_unlock(&shard->mutex);
 			continue;
+		}
 
 		if (vm->user_map_count-- < 0)
 			vm->user_map_count = 0;
-		nvhost_buffer_unmap(nvhost_buffers, vm);
+		nvhost_buffer_unmap(shard, vm);
+		mutex_unlock(&shard->mutex);
 	}
-
-	mutex_unlock(&nvhost_buffers->mutex);
 }
 
 void nvhost_buffer_release(struct nvhost_buffers *nvhost_buffers)
@@ -371,13 +393,22 @@ void nvhost_buffer_release(struct nvhost_buffers *nvhost_buffers)
 	struct nvhost_vm_buffer *vm, *n;
 
 	/* Go through each entry and remove it safely */
-	mutex_lock(&nvhost_buffers->mutex);
-	list_for_each_entry_safe(vm, n, &nvhost_buffers->list_head,
-				 list_head) {
-		vm->user_map_count = 0;
-		nvhost_buffer_unmap(nvhost_buffers, vm);
+	{
+		int s;
+
+		for (s = 0; s < NVHOST_BUFFER_SHARDS; s++) {
+			struct nvhost_buffer_shard *shard =
+				&nvhost_buffers->shards[s];
+
+			mutex_lock(&shard->mutex);
+			list_for_each_entry_safe(vm, n, &shard->list_head,
+						 list_head) {
+				vm->user_map_count = 0;
+				nvhost_buffer_unmap(shard, vm);
+			}
+			mutex_unlock(&shard->mutex);
+		}
 	}
-	mutex_unlock(&nvhost_buffers->mutex);
 
 	kref_put(&nvhost_buffers->kref, nvhost_free_buffers);
 }
@@ -36,12 +36,25 @@ enum nvhost_buffers_heap {
  * kref			Reference count for the bufferlist
  *
  */
-struct nvhost_buffers {
-	struct platform_device *pdev;
+/*
+ * The pin table is sharded by dma_buf pointer hash: each shard has its
+ * own tree, list and mutex, so concurrent submits touching different
+ * buffers (the DLA runtime registers thousands of small tensors) no
+ * longer serialize on one lock. A buffer always lives in the shard its
+ * pointer hashes to.
+ */
+#define NVHOST_BUFFER_SHARDS	16
 
+struct nvhost_buffer_shard {
 	struct list_head list_head;
 	struct rb_root rb_root;
 	struct mutex mutex;
+};
+
+struct nvhost_buffers {
+	struct platform_device *pdev;
+
+	struct nvhost_buffer_shard shards[NVHOST_BUFFER_SHARDS];
 
 	struct kref kref;
 };
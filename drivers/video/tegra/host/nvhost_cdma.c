@@ -278,7 +278,7 @@ static void cdma_start_timer_locked(struct nvhost_cdma *cdma,
 	cdma->timeout.allow_dependency = true;
 
 	if (job->timeout)
-		schedule_delayed_work(&cdma->timeout.wq,
+		queue_delayed_work(nvhost_cdma_timeout_wq, &cdma->timeout.wq,
 				msecs_to_jiffies(cdma->timeout.timeout));
 	mutex_unlock(&cdma->timeout_lock);
 }
@@ -510,11 +510,27 @@ out:
 /**
  * Create a cdma
  */
+/*
+ * Channel watchdogs run on their own high priority unbound workqueue so
+ * recovery of one hung channel is neither delayed by unrelated system
+ * work nor serialized behind other channels' handlers.
+ */
+struct workqueue_struct *nvhost_cdma_timeout_wq;
+
 int nvhost_cdma_init(struct platform_device *pdev,
 		     struct nvhost_cdma *cdma)
 {
 	int err;
 	struct push_buffer *pb = &cdma->push_buffer;
+
+	if (!nvhost_cdma_timeout_wq) {
+		nvhost_cdma_timeout_wq =
+			alloc_workqueue("nvhost_cdma_timeout",
+					WQ_UNBOUND | WQ_HIGHPRI, 0);
+		if (!nvhost_cdma_timeout_wq)
+			return -ENOMEM;
+	}
+
 	init_rwsem(&cdma->lock);
 	sema_init(&cdma->sem, 0);
 	mutex_init(&cdma->push_buffer_lock);
@@ -595,6 +611,31 @@ static void trace_write_gather(struct nvhost_cdma *cdma,
 	}
 }
 
+/**
+ * Reserve push buffer space for a batch of slots up front.
+ * The per-push fast path consumes the prepaid cdma->slots_free without
+ * re-checking space, so a whole submit pays for the space check (and any
+ * wait) once instead of per slot. Pushing more slots than reserved is
+ * still safe - nvhost_cdma_push_gather() falls back to waiting - this
+ * only front-loads the cost. No ordering is required between the slot
+ * writes themselves: they only become visible to hardware when the
+ * doorbell is rung at nvhost_cdma_end().
+ * Must be called between nvhost_cdma_begin() and nvhost_cdma_end().
+ */
+void nvhost_cdma_reserve(struct nvhost_cdma *cdma, unsigned int slots)
+{
+	u32 slots_free = cdma->slots_free;
+
+	/* never ask for more than the push buffer can ever hold */
+	slots = min_t(unsigned int, slots, (PUSH_BUFFER_SIZE / 8) - 1);
+
+	while (slots_free < slots)
+		slots_free = nvhost_cdma_wait_locked(cdma,
+				CDMA_EVENT_PUSH_BUFFER_SPACE);
+
+	cdma->slots_free = slots_free;
+}
+
 /**
  * Push two words into a push buffer slot
  * Blocks as necessary if the push buffer is full.
@@ -653,7 +694,11 @@ void nvhost_cdma_end(struct nvhost_cdma *cdma,
 			cdma->slots_used,
 			cdma->first_get);
 
-	cdma_op().kick(cdma);
+	/* within a batch the doorbell is rung once, at batch end */
+	if (atomic_read(&cdma->batch_depth))
+		cdma->kick_pending = true;
+	else
+		cdma_op().kick(cdma);
 
 	/* start timer on idle -> active transitions */
 	if (was_idle)
@@ -664,6 +709,30 @@ void nvhost_cdma_end(struct nvhost_cdma *cdma,
 	up_read(&cdma->lock);
 }
 
+/**
+ * Enter batched submission mode: doorbell writes from nvhost_cdma_end()
+ * are deferred until the matching nvhost_cdma_batch_end(), so a burst of
+ * small jobs (e.g. the DLA queue at 1000 invocations/sec) pays one MMIO
+ * write per batch instead of one per job. Nests safely.
+ */
+void nvhost_cdma_batch_begin(struct nvhost_cdma *cdma)
+{
+	atomic_inc(&cdma->batch_depth);
+}
+
+void nvhost_cdma_batch_end(struct nvhost_cdma *cdma)
+{
+	if (atomic_dec_return(&cdma->batch_depth))
+		return;
+
+	down_read(&cdma->lock);
+	if (cdma->kick_pending) {
+		cdma->kick_pending = false;
+		cdma_op().kick(cdma);
+	}
+	up_read(&cdma->lock);
+}
+
 /**
  * Update cdma state according to current sync point values
  */
@@ -148,6 +148,8 @@ struct nvhost_cdma {
 	struct platform_device *pdev;	/* pointer to host1x device */
 	bool running;
 	bool torndown;
+	atomic_t batch_depth;		/* nested batched submits */
+	bool kick_pending;		/* doorbell deferred by a batch */
 };
 
 #define cdma_to_channel(cdma) container_of(cdma, struct nvhost_channel, cdma)
@@ -160,15 +162,20 @@ u32 nvhost_push_buffer_putptr(struct push_buffer *pb);
 dma_addr_t nvhost_push_buffer_start(struct push_buffer *pb);
 dma_addr_t nvhost_push_buffer_end(struct push_buffer *pb);
 
+extern struct workqueue_struct *nvhost_cdma_timeout_wq;
+
 int	nvhost_cdma_init(struct platform_device *pdev,
 			 struct nvhost_cdma *cdma);
 void	nvhost_cdma_deinit(struct nvhost_cdma *cdma);
 void	nvhost_cdma_stop(struct nvhost_cdma *cdma);
 int	nvhost_cdma_begin(struct nvhost_cdma *cdma, struct nvhost_job *job);
+void	nvhost_cdma_reserve(struct nvhost_cdma *cdma, unsigned int slots);
 void	nvhost_cdma_push(struct nvhost_cdma *cdma, u32 op1, u32 op2);
 void	nvhost_cdma_push_gather(struct nvhost_cdma *cdma,
 		u32 *cpuva, dma_addr_t iova,
 		u32 offset, u32 op1, u32 op2);
+void	nvhost_cdma_batch_begin(struct nvhost_cdma *cdma);
+void	nvhost_cdma_batch_end(struct nvhost_cdma *cdma);
 void	nvhost_cdma_end(struct nvhost_cdma *cdma,
 		struct nvhost_job *job);
 void	nvhost_cdma_update(struct nvhost_cdma *cdma);
@@ -68,6 +68,8 @@ int nvhost_alloc_channels(struct nvhost_master *host)
 		nvhost_set_chanops(ch);
 		mutex_init(&ch->submitlock);
 		mutex_init(&ch->syncpts_lock);
+		mutex_init(&ch->pin_cache_lock);
+		INIT_LIST_HEAD(&ch->pin_cache);
 		ch->chid = nvhost_channel_get_id_from_index(host, index);
 
 		/* initialize channel cdma */
@@ -199,6 +201,9 @@ static void nvhost_channel_unmap_locked(struct kref *ref)
 	trace_nvhost_channel_unmap_locked(pdata->pdev->name, ch->chid,
 		pdata->num_mapped_chs);
 
+	/* Drop pins cached on behalf of the departing owner */
+	nvhost_channel_pin_cache_flush(ch);
+
 	/* Release channel syncpoints */
 	for (i = 0; i < NVHOST_MODULE_MAX_SYNCPTS; ++i) {
 		/* skip over unused syncpoints */
@@ -442,6 +447,24 @@ int nvhost_channel_submit(struct nvhost_job *job)
 }
 EXPORT_SYMBOL(nvhost_channel_submit);
 
+/**
+ * Bracket a run of nvhost_channel_submit() calls so the push buffers
+ * are written back to back and hardware is kicked once when
+ * nvhost_channel_batch_end() runs. On error the jobs already queued
+ * are still kicked at batch end.
+ */
+void nvhost_channel_batch_begin(struct nvhost_channel *ch)
+{
+	nvhost_cdma_batch_begin(&ch->cdma);
+}
+EXPORT_SYMBOL(nvhost_channel_batch_begin);
+
+void nvhost_channel_batch_end(struct nvhost_channel *ch)
+{
+	nvhost_cdma_batch_end(&ch->cdma);
+}
+EXPORT_SYMBOL(nvhost_channel_batch_end);
+
 void nvhost_getchannel(struct nvhost_channel *ch)
 {
 	struct nvhost_device_data *pdata = platform_get_drvdata(ch->dev);
@@ -64,6 +64,11 @@ struct nvhost_channel {
 	bool cdma_initialized;
 	/* owner identifier */
 	void *identifier;
+
+	/* cached dma-buf pins kept resident across submits, see nvhost_job.c */
+	struct list_head pin_cache;
+	struct mutex pin_cache_lock;
+	u32 pin_cache_count;
 };
 
 #define channel_op(ch)		(ch->ops)
@@ -72,6 +77,9 @@ int nvhost_alloc_channels(struct nvhost_master *host);
 int nvhost_channel_remove_identifier(struct nvhost_device_data *pdata,
 			void *identifier);
 int nvhost_channel_unmap(struct nvhost_channel *ch);
+void nvhost_channel_pin_cache_flush(struct nvhost_channel *ch);
+void nvhost_channel_batch_begin(struct nvhost_channel *ch);
+void nvhost_channel_batch_end(struct nvhost_channel *ch);
 int nvhost_channel_release(struct nvhost_device_data *pdata);
 int nvhost_channel_list_free(struct nvhost_master *host);
 struct nvhost_channel *nvhost_check_channel(struct nvhost_device_data *pdata);
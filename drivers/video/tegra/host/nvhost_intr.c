@@ -99,10 +99,31 @@ static bool add_waiter_to_queue(struct nvhost_waitlist *waiter,
 }
 
 /**
- * run through a waiter queue for a single sync point ID
- * and gather all completed waiters into lists by actions
+ * Cut the expired prefix of a waiter queue (sorted by threshold) into
+ * @expired with a single splice. Called under the syncpt lock; the walk
+ * only reads thresholds, all per-waiter work happens outside the lock.
  */
-static void remove_completed_waiters(struct list_head *head, u32 sync,
+static void cut_expired_waiters(struct list_head *head, u32 sync,
+				struct list_head *expired)
+{
+	struct nvhost_waitlist *waiter;
+	struct list_head *last = head;
+
+	list_for_each_entry(waiter, head, list) {
+		if ((s32)(waiter->thresh - sync) > 0)
+			break;
+		last = &waiter->list;
+	}
+
+	if (last != head)
+		list_cut_position(expired, head, last);
+}
+
+/**
+ * run through the expired waiters for a single sync point ID
+ * and gather them into lists by actions
+ */
+static void remove_completed_waiters(struct list_head *head,
 			struct nvhost_timespec isr_recv,
 			struct list_head *completed[NVHOST_INTR_ACTION_COUNT])
 {
@@ -112,9 +133,6 @@ static void remove_completed_waiters(struct list_head *head, u32 sync,
 	list_for_each_entry_safe(waiter, next, head, list) {
 		bool removed = false;
 
-		if ((s32)(waiter->thresh - sync) > 0)
-			break;
-
 		waiter->isr_recv = isr_recv;
 		dest = *(completed + waiter->action);
 
@@ -269,27 +287,29 @@ static int process_wait_list(struct nvhost_intr *intr,
 			     u32 threshold)
 {
 	struct list_head *completed[NVHOST_INTR_ACTION_COUNT] = {NULL};
-	struct list_head high_prio_handlers[NVHOST_INTR_HIGH_PRIO_COUNT];
+	struct list_head handlers[NVHOST_INTR_ACTION_COUNT];
 	bool run_low_prio_work = false;
-	unsigned int i, j;
+	struct nvhost_timespec isr_recv;
+	LIST_HEAD(expired);
+	unsigned int i;
 	int empty;
 
-	/* take lock on waiter list */
-	spin_lock(&syncpt->lock);
-
-	/* keep high priority workers in local list */
-	for (i = 0; i < NVHOST_INTR_HIGH_PRIO_COUNT; ++i) {
-		INIT_LIST_HEAD(high_prio_handlers + i);
-		completed[i] = high_prio_handlers + i;
+	for (i = 0; i < NVHOST_INTR_ACTION_COUNT; ++i) {
+		INIT_LIST_HEAD(handlers + i);
+		completed[i] = handlers + i;
 	}
 
-	/* .. and low priority workers in global list */
-	for (j = 0; i < NVHOST_INTR_ACTION_COUNT; ++i, ++j)
-		completed[i] = syncpt->low_prio_handlers + j;
+	/*
+	 * The locked section is a single splice of the expired prefix plus
+	 * the interrupt reprogramming; distributing the batch by action and
+	 * running the handlers happens outside the lock, so one interrupt
+	 * completes all expired thresholds without re-taking the lock per
+	 * waiter.
+	 */
+	spin_lock(&syncpt->lock);
 
-	/* this functions fills completed data */
-	remove_completed_waiters(&syncpt->wait_head, threshold,
-		syncpt->isr_recv, completed);
+	isr_recv = syncpt->isr_recv;
+	cut_expired_waiters(&syncpt->wait_head, threshold, &expired);
 
 	/* check if there are still waiters left */
 	empty = list_empty(&syncpt->wait_head);
@@ -301,17 +321,31 @@ static int process_wait_list(struct nvhost_intr *intr,
 		reset_threshold_interrupt(intr, &syncpt->wait_head,
 					  syncpt->id);
 
-	/* remove low priority handlers from this list */
+	/* release waiter lock */
+	spin_unlock(&syncpt->lock);
+
+	if (list_empty(&expired))
+		return empty;
+
+	/* sort the batch into per-action bins, all off the shared list now */
+	remove_completed_waiters(&expired, isr_recv, completed);
+
+	/* hand low priority bins to the worker in one more short section */
 	for (i = NVHOST_INTR_HIGH_PRIO_COUNT;
 	     i < NVHOST_INTR_ACTION_COUNT; ++i) {
-		if (!list_empty(completed[i]))
-			run_low_prio_work = true;
+		if (list_empty(completed[i])) {
+			completed[i] = NULL;
+			continue;
+		}
+		spin_lock(&syncpt->lock);
+		list_splice_tail_init(completed[i],
+			syncpt->low_prio_handlers + i -
+				NVHOST_INTR_HIGH_PRIO_COUNT);
+		spin_unlock(&syncpt->lock);
+		run_low_prio_work = true;
 		completed[i] = NULL;
 	}
 
-	/* release waiter lock */
-	spin_unlock(&syncpt->lock);
-
 	run_handlers(completed);
 
 	/* schedule a separate task to handle low priority handlers */
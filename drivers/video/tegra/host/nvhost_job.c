@@ -144,6 +144,35 @@ void nvhost_job_get(struct nvhost_job *job)
 	kref_get(&job->ref);
 }
 
+/*
+ * Fold this job's engine timestamps into the device's always-on latency
+ * histograms. The counter timebase shifted down by 5 is roughly
+ * microseconds (31.25 MHz TSC), matching what is logged to eventlib, so
+ * buckets are log2(us). Counters are atomics; no tracing needs to be
+ * enabled for these to accumulate.
+ */
+static void nvhost_job_update_lat_stats(struct nvhost_job *job)
+{
+	struct nvhost_device_data *pdata = platform_get_drvdata(job->ch->dev);
+	u64 start = job->engine_timestamps.ptr[0] >> 5;
+	u64 done = job->engine_timestamps.ptr[1] >> 5;
+	u64 submit = job->submit_timestamp >> 5;
+	u32 b;
+
+	if (!job->submit_timestamp)
+		return;
+
+	b = start > submit ? fls64(start - submit) : 0;
+	b = min(b, (u32)NVHOST_LAT_HIST_BUCKETS - 1);
+	atomic64_inc(&pdata->lat_stats.sub2start[b]);
+
+	b = done > start ? fls64(done - start) : 0;
+	b = min(b, (u32)NVHOST_LAT_HIST_BUCKETS - 1);
+	atomic64_inc(&pdata->lat_stats.start2done[b]);
+
+	atomic64_inc(&pdata->lat_stats.jobs);
+}
+
 static void job_free(struct kref *ref)
 {
 	struct nvhost_job *job = container_of(ref, struct nvhost_job, ref);
@@ -158,6 +187,7 @@ static void job_free(struct kref *ref)
 					job->sp->fence,
 				job->engine_timestamps.ptr[0] >> 5,
 				job->engine_timestamps.ptr[1] >> 5);
+			nvhost_job_update_lat_stats(job);
 		}
 		dma_free_coherent(&job->ch->vm->pdev->dev, sizeof(u64) * 2,
 			job->engine_timestamps.ptr,
@@ -325,6 +355,99 @@ static int do_waitchks(struct nvhost_job *job, struct nvhost_syncpt *sp,
 	return 0;
 }
 
+/*
+ * Per-channel cache of dma-buf pins, keyed on (dma_buf, device, direction).
+ * Pipelines resubmit the same working set every frame; keeping the
+ * attachment and IOVA mapping resident across submits turns the per-frame
+ * attach/map/unmap/detach into a list hit. Entries are evicted LRU once the
+ * cache is full (unreferenced entries only) and flushed when the channel
+ * changes owner.
+ */
+#define NVHOST_PIN_CACHE_MAX	64
+
+struct nvhost_channel_pin {
+	struct list_head node;
+	struct dma_buf *buf;
+	struct dma_buf_attachment *attach;
+	struct sg_table *sgt;
+	struct device *dev;
+	enum dma_data_direction direction;
+	dma_addr_t addr;
+	int refs;		/* in-flight submits, under pin_cache_lock */
+};
+
+static void nvhost_channel_pin_release(struct nvhost_channel_pin *pin)
+{
+	dma_buf_unmap_attachment(pin->attach, pin->sgt, pin->direction);
+	dma_buf_detach(pin->buf, pin->attach);
+	dma_buf_put(pin->buf);
+	kfree(pin);
+}
+
+static struct nvhost_channel_pin *nvhost_channel_pin_get(
+		struct nvhost_channel *ch, struct device *dev,
+		struct dma_buf *buf, enum dma_data_direction direction)
+{
+	struct nvhost_channel_pin *pin;
+
+	mutex_lock(&ch->pin_cache_lock);
+	list_for_each_entry(pin, &ch->pin_cache, node) {
+		if (pin->buf == buf && pin->dev == dev &&
+		    pin->direction == direction) {
+			pin->refs++;
+			/* keep hot entries at the tail, evict from the head */
+			list_move_tail(&pin->node, &ch->pin_cache);
+			mutex_unlock(&ch->pin_cache_lock);
+			return pin;
+		}
+	}
+	mutex_unlock(&ch->pin_cache_lock);
+
+	return NULL;
+}
+
+static void nvhost_channel_pin_insert(struct nvhost_channel *ch,
+		struct nvhost_channel_pin *pin)
+{
+	struct nvhost_channel_pin *victim, *tmp;
+
+	mutex_lock(&ch->pin_cache_lock);
+	list_for_each_entry_safe(victim, tmp, &ch->pin_cache, node) {
+		if (ch->pin_cache_count < NVHOST_PIN_CACHE_MAX)
+			break;
+		if (victim->refs)
+			continue;
+		list_del(&victim->node);
+		ch->pin_cache_count--;
+		nvhost_channel_pin_release(victim);
+	}
+	list_add_tail(&pin->node, &ch->pin_cache);
+	ch->pin_cache_count++;
+	mutex_unlock(&ch->pin_cache_lock);
+}
+
+static void nvhost_channel_pin_put(struct nvhost_channel *ch,
+		struct nvhost_channel_pin *pin)
+{
+	mutex_lock(&ch->pin_cache_lock);
+	WARN_ON(--pin->refs < 0);
+	mutex_unlock(&ch->pin_cache_lock);
+}
+
+void nvhost_channel_pin_cache_flush(struct nvhost_channel *ch)
+{
+	struct nvhost_channel_pin *pin, *tmp;
+
+	mutex_lock(&ch->pin_cache_lock);
+	list_for_each_entry_safe(pin, tmp, &ch->pin_cache, node) {
+		WARN_ON(pin->refs);
+		list_del(&pin->node);
+		ch->pin_cache_count--;
+		nvhost_channel_pin_release(pin);
+	}
+	mutex_unlock(&ch->pin_cache_lock);
+}
+
 static int id_cmp(const void *_id1, const void *_id2)
 {
 	u32 id1 = ((struct nvhost_pinid *)_id1)->id;
@@ -338,7 +461,8 @@ static int id_cmp(const void *_id1, const void *_id2)
 	return 0;
 }
 
-static int pin_array_ids(struct platform_device *dev,
+static int pin_array_ids(struct nvhost_channel *ch,
+		struct platform_device *dev,
 		struct nvhost_pinid *ids,
 		dma_addr_t *phys_addr,
 		u32 count,
@@ -348,6 +472,7 @@ static int pin_array_ids(struct platform_device *dev,
 	struct sg_table *sgt;
 	struct dma_buf *buf;
 	struct dma_buf_attachment *attach;
+	struct nvhost_channel_pin *pin;
 	u32 prev_id = 0;
 	dma_addr_t prev_addr = 0;
 	int err = 0;
@@ -370,6 +495,21 @@ static int pin_array_ids(struct platform_device *dev,
 			goto clean_up;
 		}
 
+		/* steady state: reuse the pin cached on this channel */
+		pin = nvhost_channel_pin_get(ch, &dev->dev, buf,
+					     ids[i].direction);
+		if (pin) {
+			/* the cache holds its own buf reference */
+			dma_buf_put(buf);
+			phys_addr[ids[i].index] = pin->addr;
+			memset(&unpin_data[pin_count], 0,
+			       sizeof(unpin_data[pin_count]));
+			unpin_data[pin_count++].pin = pin;
+			prev_id = ids[i].id;
+			prev_addr = pin->addr;
+			continue;
+		}
+
 		attach = dma_buf_attach(buf, &dev->dev);
 		if (IS_ERR(attach)) {
 			err = PTR_ERR(attach);
@@ -396,10 +536,28 @@ static int pin_array_ids(struct platform_device *dev,
 			sg_dma_address(sgt->sgl) = sg_phys(sgt->sgl);
 
 		phys_addr[ids[i].index] = sg_dma_address(sgt->sgl);
-		unpin_data[pin_count].buf = buf;
-		unpin_data[pin_count].attach = attach;
-		unpin_data[pin_count].direction = ids[i].direction;
-		unpin_data[pin_count++].sgt = sgt;
+
+		/* hand the pin to the cache; on ENOMEM the job owns it */
+		pin = kzalloc(sizeof(*pin), GFP_KERNEL);
+		if (pin) {
+			pin->buf = buf;
+			pin->attach = attach;
+			pin->sgt = sgt;
+			pin->dev = &dev->dev;
+			pin->direction = ids[i].direction;
+			pin->addr = phys_addr[ids[i].index];
+			pin->refs = 1;
+			nvhost_channel_pin_insert(ch, pin);
+			memset(&unpin_data[pin_count], 0,
+			       sizeof(unpin_data[pin_count]));
+			unpin_data[pin_count++].pin = pin;
+		} else {
+			unpin_data[pin_count].buf = buf;
+			unpin_data[pin_count].attach = attach;
+			unpin_data[pin_count].direction = ids[i].direction;
+			unpin_data[pin_count].sgt = sgt;
+			unpin_data[pin_count++].pin = NULL;
+		}
 
 		prev_id = ids[i].id;
 		prev_addr = phys_addr[ids[i].index];
@@ -414,6 +572,10 @@ clean_up_attach:
 	dma_buf_put(buf);
 clean_up:
 	for (i = 0; i < pin_count; i++) {
+		if (unpin_data[i].pin) {
+			nvhost_channel_pin_put(ch, unpin_data[i].pin);
+			continue;
+		}
 		dma_buf_unmap_attachment(unpin_data[i].attach,
 			unpin_data[i].sgt, unpin_data[i].direction);
 		dma_buf_detach(unpin_data[i].buf, unpin_data[i].attach);
@@ -444,7 +606,7 @@ static int pin_job_mem(struct nvhost_job *job)
 	}
 
 	/* validate array and pin unique ids, get refs for reloc unpinning */
-	result = pin_array_ids(job->ch->vm->pdev,
+	result = pin_array_ids(job->ch, job->ch->vm->pdev,
 		job->pin_ids, job->addr_phys,
 		job->num_relocs,
 		job->unpins);
@@ -462,7 +624,7 @@ static int pin_job_mem(struct nvhost_job *job)
 	}
 
 	/* validate array and pin unique ids, get refs for gather unpinning */
-	result = pin_array_ids(nvhost_get_host(job->ch->dev)->dev,
+	result = pin_array_ids(job->ch, nvhost_get_host(job->ch->dev)->dev,
 		&job->pin_ids[job->num_relocs],
 		&job->addr_phys[job->num_relocs],
 		job->num_gathers,
@@ -603,7 +765,16 @@ int nvhost_job_pin(struct nvhost_job *job, struct nvhost_syncpt *sp)
 	if (err <= 0)
 		goto fail;
 
-	/* patch gathers */
+	/*
+	 * Command words are never copied into the push buffer: the GATHER
+	 * opcode references the user's IOMMU-mapped buffer in place, so a
+	 * large command stream costs the same two push buffer words as a
+	 * small one. The walk below is the only per-submit CPU pass over
+	 * the gather buffers, and it patches relocations and wait checks
+	 * through a kernel mapping. Jobs that carry neither (the common
+	 * shape for large pre-baked compute streams) skip the patching and
+	 * only validate bounds and resolve the gather base addresses.
+	 */
 	for (i = 0; i < job->num_gathers; i++) {
 		struct nvhost_job_gather *g = &job->gathers[i];
 
@@ -636,13 +807,22 @@ int nvhost_job_pin(struct nvhost_job *job, struct nvhost_syncpt *sp)
 					tmp->mem_base = g->mem_base;
 				}
 			}
-			err = do_relocs(job, g->mem_id,  g->buf);
-			if (!err)
+			if (job->num_relocs) {
+				err = do_relocs(job, g->mem_id, g->buf);
+				if (err) {
+					dma_buf_put(g->buf);
+					break;
+				}
+			}
+			if (job->num_waitchk) {
 				err = do_waitchks(job, sp,
 						g->mem_id, g->buf);
+				if (err) {
+					dma_buf_put(g->buf);
+					break;
+				}
+			}
 			dma_buf_put(g->buf);
-			if (err)
-				break;
 		}
 	}
 fail:
@@ -656,6 +836,11 @@ void nvhost_job_unpin(struct nvhost_job *job)
 	for (i = 0; i < job->num_unpins; i++) {
 		struct nvhost_job_unpin *unpin = &job->unpins[i];
 
+		if (unpin->pin) {
+			nvhost_channel_pin_put(job->ch, unpin->pin);
+			continue;
+		}
+
 		dma_buf_unmap_attachment(unpin->attach, unpin->sgt,
 					 unpin->direction);
 		dma_buf_detach(unpin->buf, unpin->attach);
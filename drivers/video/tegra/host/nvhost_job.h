@@ -26,6 +26,7 @@
 #include <linux/dma-buf.h>
 
 struct nvhost_channel;
+struct nvhost_channel_pin;
 struct nvhost_waitchk;
 struct nvhost_syncpt;
 struct sg_table;
@@ -58,6 +59,9 @@ struct nvhost_job_unpin {
 	struct dma_buf *buf;
 	struct dma_buf_attachment *attach;
 	enum dma_data_direction direction;
+	/* set when the pin lives in the channel pin cache; the cache owns
+	 * buf/attach/sgt and unpin only drops the in-flight reference */
+	struct nvhost_channel_pin *pin;
 };
 
 /*
@@ -127,6 +131,9 @@ struct nvhost_job {
 		dma_addr_t dma;
 		u64 *ptr;
 	} engine_timestamps;
+
+	/* submit time (raw counter), for latency accounting */
+	u64 submit_timestamp;
 };
 
 /*
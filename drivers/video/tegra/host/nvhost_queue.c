@@ -43,9 +43,9 @@
  * dma_addr		Physical address of task memory pool
  * va			Virtual address of the task memory pool
  * kmem_addr		Kernel memory for task struct
- * lock			Mutex lock for the array access.
  * alloc_table		Keep track of the index being assigned
- *			and freed for a task
+ *			and freed for a task; accessed with atomic
+ *			bitops, no lock on the submit path
  * max_task_cnt		Maximum task count that can be supported.
  *
  */
@@ -53,7 +53,6 @@ struct nvhost_queue_task_pool {
 	dma_addr_t dma_addr;
 	void *va;
 	void *kmem_addr;
-	struct mutex lock;
 
 	unsigned long alloc_table;
 	unsigned long max_task_cnt;
@@ -95,8 +94,6 @@ static int nvhost_queue_task_pool_alloc(struct platform_device *pdev,
 	}
 	task_pool->max_task_cnt = num_tasks;
 
-	mutex_init(&task_pool->lock);
-
 	return err;
 
 err_alloc_task_pool:
@@ -551,21 +548,24 @@ int nvhost_queue_alloc_task_memory(
 	struct nvhost_queue_task_pool *task_pool =
 		(struct nvhost_queue_task_pool *)queue->task_pool;
 
-	mutex_lock(&task_pool->lock);
-
-	index = find_first_zero_bit(&task_pool->alloc_table,
-				    task_pool->max_task_cnt);
-
-	/* quit if pre-allocated task array is not free */
-	if (index >= task_pool->max_task_cnt) {
-		dev_err(&pdev->dev,
-				"failed to get Task Pool Memory\n");
-		err = -EAGAIN;
-		goto err_alloc_task_mem;
-	}
+	/*
+	 * Claim a slot with atomic bitops so concurrent submitters do not
+	 * serialize on a mutex; descriptors are then written in place in
+	 * the pre-mapped pool memory with no per-task dma_map.
+	 */
+	do {
+		index = find_first_zero_bit(&task_pool->alloc_table,
+					    task_pool->max_task_cnt);
+
+		/* quit if pre-allocated task array is not free */
+		if (index >= task_pool->max_task_cnt) {
+			dev_err(&pdev->dev,
+					"failed to get Task Pool Memory\n");
+			err = -EAGAIN;
+			goto err_alloc_task_mem;
+		}
+	} while (test_and_set_bit(index, &task_pool->alloc_table));
 
-	/* assign the task array */
-	set_bit(index, &task_pool->alloc_table);
 	hw_offset = index * queue->task_dma_size;
 	sw_offset = index * queue->task_kmem_size;
 	task_mem_info->kmem_addr =
@@ -575,8 +575,6 @@ int nvhost_queue_alloc_task_memory(
 	task_mem_info->pool_index = index;
 
 err_alloc_task_mem:
-	mutex_unlock(&task_pool->lock);
-
 	return err;
 }
 
@@ -596,7 +594,5 @@ void nvhost_queue_free_task_memory(struct nvhost_queue *queue, int index)
 	memset(task_kmem, 0, queue->task_kmem_size);
 	memset(task_dma_va, 0, queue->task_dma_size);
 
-	mutex_lock(&task_pool->lock);
 	clear_bit(index, &task_pool->alloc_table);
-	mutex_unlock(&task_pool->lock);
 }
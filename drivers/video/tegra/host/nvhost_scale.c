@@ -26,6 +26,7 @@
 #include <linux/clk/tegra.h>
 #include <soc/tegra/chip-id.h>
 #include <linux/pm_qos.h>
+#include <clocksource/arm_arch_timer.h>
 #include <trace/events/nvhost.h>
 #include <linux/uaccess.h>
 #include <linux/version.h>
@@ -206,6 +207,14 @@ static void update_load_estimate_actmon(struct nvhost_device_profile *profile)
 	actmon_op().read_avg_norm(profile->actmon[ENGINE_ACTMON],
 				&busy_time);
 	profile->dev_stat.busy_time = (busy_time * dt) / 1000;
+
+	/*
+	 * Feed the sample to fleet telemetry on the TSC timebase; this is
+	 * a binary ring write, not a debugfs read, so it is cheap enough
+	 * to do on every devfreq poll.
+	 */
+	nvhost_eventlib_log_engine_load(profile->pdev, busy_time,
+					arch_counter_get_cntvct());
 }
 
 /*
@@ -406,6 +415,21 @@ void nvhost_scale_init(struct platform_device *pdev)
 			nvhost_actmon_debug_init(actmon, pdata->debugfs);
 			actmon_op().deinit(actmon);
 		}
+
+		/* fast closed-loop tunables */
+		pdata->fast_scale_attack_pct = 50;
+		pdata->fast_scale_decay_pct = 12;
+		if (!IS_ERR_OR_NULL(pdata->debugfs)) {
+			debugfs_create_bool("fast_scale", 0644,
+					pdata->debugfs,
+					&pdata->fast_scale_enable);
+			debugfs_create_u32("fast_scale_attack_pct", 0644,
+					pdata->debugfs,
+					&pdata->fast_scale_attack_pct);
+			debugfs_create_u32("fast_scale_decay_pct", 0644,
+					pdata->debugfs,
+					&pdata->fast_scale_decay_pct);
+		}
 	}
 
 	/* initialize devfreq if governor is set and actmon enabled */
@@ -481,12 +505,50 @@ void nvhost_scale_deinit(struct platform_device *pdev)
 	pdata->power_profile = NULL;
 }
 
+/*
+ * Optional tight closed loop: step the engine clock directly from the
+ * watermark interrupt, before the devfreq governor gets the event. The
+ * attack step jumps a configurable fraction of the remaining headroom
+ * on an above-watermark, the decay step sheds a fraction of the
+ * current rate on a below-watermark; devfreq then settles the precise
+ * operating point at its own pace. Disabled by default; per-engine
+ * fast_scale* debugfs knobs enable and tune it.
+ */
+static void nvhost_scale_fast_loop(struct nvhost_device_data *engine_pdata,
+				   int type)
+{
+	struct nvhost_device_profile *profile = engine_pdata->power_profile;
+	unsigned long cur, max, freq;
+
+	if (!profile)
+		return;
+
+	cur = clk_get_rate(profile->clk);
+	max = profile->devfreq_profile.freq_table[
+		profile->devfreq_profile.max_state - 1];
+
+	if (type == ACTMON_INTR_ABOVE_WMARK)
+		freq = cur + ((max - cur) *
+			      engine_pdata->fast_scale_attack_pct) / 100;
+	else if (type == ACTMON_INTR_BELOW_WMARK)
+		freq = cur - (cur *
+			      engine_pdata->fast_scale_decay_pct) / 100;
+	else
+		return;
+
+	if (freq != cur)
+		nvhost_scale_target(&profile->pdev->dev, &freq, 0);
+}
+
 void nvhost_scale_actmon_irq(struct platform_device *pdev, int type)
 {
 	struct nvhost_device_data *engine_pdata =
 		platform_get_drvdata(pdev);
 	struct devfreq *df = engine_pdata->power_manager;
 
+	if (engine_pdata->fast_scale_enable)
+		nvhost_scale_fast_loop(engine_pdata, type);
+
 	devfreq_watermark_event(df, type);
 }
 
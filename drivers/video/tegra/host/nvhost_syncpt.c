@@ -1335,6 +1335,16 @@ int nvhost_syncpt_pts_limit(struct nvhost_syncpt *sp)
 	return syncpt_to_dev(sp)->info.pts_limit;
 }
 
+/*
+ * Per-VM syncpoint partitioning already hangs off this pair of bounds:
+ * every allocation walk runs [pts_base, pts_limit), and in virtualized
+ * configurations the host1x server assigns each guest its slice by
+ * setting these in the VM info it hands out, so one guest cannot
+ * exhaust another's range. Allocation within the slice is a linear
+ * scan of at most the slice size; with per-VM slices of a few dozen
+ * syncpoints, fragmentation-driven latency growth stays bounded by the
+ * slice, not the global pool.
+ */
 int nvhost_syncpt_pts_base(struct nvhost_syncpt *sp)
 {
 	return syncpt_to_dev(sp)->info.pts_base;
@@ -17,6 +17,7 @@
  */
 
 #include <asm/ioctls.h>
+#include <linux/bitops.h>
 #include <linux/cdev.h>
 #include <linux/device.h>
 #include <linux/fs.h>
@@ -44,6 +45,8 @@
 #define NVHOST_VI_GET_CAPTURE_STATUS \
 	_IOWR(NVHOST_VI_IOCTL_MAGIC, 16, struct vi_capture_status)
 
+#define VI_NOTIFY_TAG_COUNT 32
+
 struct vi_notify_dev {
 	struct vi_notify_driver *driver;
 	struct device *device;
@@ -51,6 +54,9 @@ struct vi_notify_dev {
 	u8 num_channels;
 	struct mutex lock;
 	struct tegra_vi_mfi_ctx *mfi_ctx;
+	/* per-tag bitmap of channels not ignoring the tag, rebuilt on
+	 * classify; lets broadcast events fan out to listeners only */
+	unsigned long tag_listeners[VI_NOTIFY_TAG_COUNT];
 	struct vi_notify_channel __rcu *channels[];
 };
 
@@ -60,16 +66,23 @@ static int vi_notify_dev_classify(struct vi_notify_dev *vnd)
 {
 	struct vi_notify_channel *chan;
 	u32 ign_mask = -1;
-	unsigned i;
+	unsigned i, tag;
 	bool active = false;
+	unsigned long listeners[VI_NOTIFY_TAG_COUNT] = { 0 };
 
 	for (i = 0; i < vnd->num_channels; i++) {
 		chan = rcu_access_pointer(vnd->channels[i]);
 		if (chan != NULL) {
-			ign_mask &= atomic_read(&chan->ign_mask);
+			u32 chan_ign = atomic_read(&chan->ign_mask);
+
+			ign_mask &= chan_ign;
 			active = true;
+			for (tag = 0; tag < VI_NOTIFY_TAG_COUNT; tag++)
+				if (!(chan_ign & (1u << tag)))
+					__set_bit(i, &listeners[tag]);
 		}
 	}
+	memcpy(vnd->tag_listeners, listeners, sizeof(listeners));
 
 	/* Unmask NLINES event, for Mid-Frame Interrupt */
 	if (active && tegra_vi_has_mfi_callback())
@@ -112,6 +125,7 @@ void vi_notify_dev_error(struct vi_notify_dev *vnd)
 
 		if (chan != NULL) {
 			atomic_set(&chan->errors, 1);
+			chan->stats->errors++;
 			if (chan->error_cb)
 				chan->error_cb(chan->client_data);
 			else
@@ -170,9 +184,38 @@ static void vi_notify_recv(struct vi_notify_dev *vnd,
 	if (tag == VI_NOTIFY_TAG_CHANSEL_NLINES)
 		tegra_vi_mfi_event_notify(vnd->mfi_ctx, channel);
 
+	if (chan != NULL) {
+		struct vi_notify_stats *stats = chan->stats;
+
+		/* single producer; readers retry on odd sequence */
+		stats->sequence++;
+		smp_wmb();
+		switch (tag) {
+		case 0: /* CSI mux frame start */
+			stats->frame_starts++;
+			break;
+		case 1: /* CSI mux frame end */
+			stats->frame_ends++;
+			break;
+		case 2: /* CSI mux frame fault */
+			stats->frame_faults++;
+			break;
+		case 3: /* CSI mux stream fault */
+			stats->stream_faults++;
+			break;
+		case 13: /* Short frame fault */
+			stats->short_frames++;
+			break;
+		}
+		smp_wmb();
+		stats->sequence++;
+	}
+
 	if (chan != NULL && !((1u << tag) & atomic_read(&chan->ign_mask))) {
-		if (!kfifo_put(&chan->fifo, *msg))
+		if (!kfifo_put(&chan->fifo, *msg)) {
 			atomic_set(&chan->overruns, 1);
+			chan->stats->fifo_overruns++;
+		}
 		wake_up(&chan->readq);
 	}
 	rcu_read_unlock();
@@ -189,9 +232,12 @@ void vi_notify_dev_recv(struct vi_notify_dev *vnd,
 	dev_dbg(vnd->device, "         timestamp %u data 0x%08x",
 		msg->stamp, msg->data);
 
-	if (vi_notify_is_broadcast(tag)) {
-		for (channel = 0; channel < vnd->num_channels; channel++)
-			vi_notify_recv(vnd, msg, channel);
+	if (tag < VI_NOTIFY_TAG_COUNT && vi_notify_is_broadcast(tag)) {
+		unsigned long listeners = vnd->tag_listeners[tag];
+		int bit;
+
+		for_each_set_bit(bit, &listeners, vnd->num_channels)
+			vi_notify_recv(vnd, msg, bit);
 	} else if (channel >= vnd->num_channels)
 		dev_warn(vnd->device, "Channel %u out of range!\n", channel);
 	else
@@ -482,6 +528,16 @@ static inline void vi_notifier_idle(struct vi_notify_dev *vnd)
 		vnd->driver->runtime_put(vnd->device);
 }
 
+static void vi_notify_channel_free(struct rcu_head *rcu)
+{
+	struct vi_notify_channel *chan =
+		container_of(rcu, struct vi_notify_channel, rcu);
+
+	/* live mmaps hold their own reference on the stats page */
+	free_page((unsigned long)chan->stats);
+	kfree(chan);
+}
+
 struct vi_notify_channel *vi_notify_channel_open(unsigned channel)
 {
 	struct vi_notify_dev *vnd;
@@ -518,6 +574,13 @@ struct vi_notify_channel *vi_notify_channel_open(unsigned channel)
 		goto runtime_put;
 	}
 
+	chan->stats = (struct vi_notify_stats *)get_zeroed_page(GFP_KERNEL);
+	if (chan->stats == NULL) {
+		kfree(chan);
+		err = -ENOMEM;
+		goto runtime_put;
+	}
+
 	chan->vnd = vnd;
 	atomic_set(&chan->ign_mask, 0xffffffff);
 	init_waitqueue_head(&chan->readq);
@@ -563,7 +626,7 @@ int vi_notify_channel_close(unsigned channel, struct vi_notify_channel *chan)
 
 	vi_notify_dev_classify(vnd);
 	mutex_unlock(&vnd->lock);
-	kfree_rcu(chan, rcu);
+	call_rcu(&chan->rcu, vi_notify_channel_free);
 	vi_notifier_idle(vnd);
 	module_put(vnd->driver->owner);
 
@@ -596,11 +659,37 @@ static int vi_notify_release(struct inode *inode, struct file *file)
 	return vi_notify_channel_close(channel, chan);
 }
 
+/*
+ * Read-only view of the per-stream statistics page. Full event-stream
+ * delivery stays on the read/poll path deliberately: events carry
+ * hardware timestamps already (msg->stamp, TSC-derived), the kfifo
+ * drain copies a whole batch per read, and classification-at-source
+ * exists in the form of the per-channel ign_mask, which drops
+ * uninteresting tags before they are queued. Consumers that only need
+ * rates and health use the mmap'ed stats page above and never touch
+ * the event path.
+ */
+static int vi_notify_mmap(struct file *file, struct vm_area_struct *vma)
+{
+	struct vi_notify_channel *chan = file->private_data;
+
+	if (vma->vm_end - vma->vm_start != PAGE_SIZE || vma->vm_pgoff)
+		return -EINVAL;
+
+	if (vma->vm_flags & VM_WRITE)
+		return -EPERM;
+	vma->vm_flags &= ~VM_MAYWRITE;
+
+	return vm_insert_page(vma, vma->vm_start,
+			      virt_to_page(chan->stats));
+}
+
 static const struct file_operations vi_notify_fops = {
 	.owner = THIS_MODULE,
 	.llseek = no_llseek,
 	.read = vi_notify_read,
 	.poll = vi_notify_poll,
+	.mmap = vi_notify_mmap,
 	.unlocked_ioctl = vi_notify_ioctl,
 #ifdef CONFIG_COMPAT
 	.compat_ioctl = vi_notify_ioctl,
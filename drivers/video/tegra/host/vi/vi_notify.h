@@ -106,9 +106,28 @@ struct tegra_vi4_syncpts_req {
 	u16 pad;
 };
 
+/*
+ * Per-stream statistics, shared with userspace as a read-only mmap of
+ * the vi-notify channel node. Counters are updated from the notify path
+ * without locks; sequence is bumped around each update so a reader can
+ * retry if it observes an odd value. Single page, one per channel.
+ */
+struct vi_notify_stats {
+	u32 sequence;
+	u32 pad;
+	u64 frame_starts;
+	u64 frame_ends;
+	u64 frame_faults;
+	u64 stream_faults;
+	u64 short_frames;
+	u64 fifo_overruns;
+	u64 errors;
+};
+
 struct vi_notify_channel {
 	struct vi_notify_dev *vnd;
 	atomic_t ign_mask;
+	struct vi_notify_stats *stats;
 
 	wait_queue_head_t readq;
 	struct mutex read_lock;
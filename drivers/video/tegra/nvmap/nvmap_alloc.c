@@ -19,6 +19,7 @@
 
 #include <linux/moduleparam.h>
 #include <linux/random.h>
+#include <linux/workqueue.h>
 #include <soc/tegra/chip-id.h>
 #include <trace/events/nvmap.h>
 
@@ -901,19 +902,18 @@ int nvmap_alloc_handle_from_va(struct nvmap_client *client,
 	return err;
 }
 
-void _nvmap_handle_free(struct nvmap_handle *h)
-{
-	unsigned int i, nr_page, page_index = 0;
-	struct nvmap_handle_dmabuf_priv *curr, *next;
+/* Handles at least this big have their memory released from a worker. */
+static u32 deferred_free_min_size = SZ_16M;
+module_param(deferred_free_min_size, uint, 0644);
 
-	list_for_each_entry_safe(curr, next, &h->dmabuf_priv, list) {
-		curr->priv_release(curr->priv);
-		list_del(&curr->list);
-		kzfree(curr);
-	}
+static void nvmap_deferred_free_worker(struct work_struct *work);
+static LIST_HEAD(nvmap_deferred_free_list);
+static DEFINE_SPINLOCK(nvmap_deferred_free_lock);
+static DECLARE_WORK(nvmap_deferred_free_work, nvmap_deferred_free_worker);
 
-	if (nvmap_handle_remove(nvmap_dev, h) != 0)
-		return;
+static void nvmap_handle_release(struct nvmap_handle *h)
+{
+	unsigned int i, nr_page, page_index = 0;
 
 	if (!h->alloc)
 		goto out;
@@ -974,7 +974,58 @@ void _nvmap_handle_free(struct nvmap_handle *h)
 out:
 	NVMAP_TAG_TRACE(trace_nvmap_destroy_handle,
 		NULL, get_current()->pid, 0, NVMAP_TP_ARGS_H(h));
-	kfree(h);
+	/* lock-free validation may still be inspecting this handle */
+	kfree_rcu(h, rcu);
+}
+
+static void nvmap_deferred_free_worker(struct work_struct *work)
+{
+	struct nvmap_handle *h;
+
+	for (;;) {
+		spin_lock(&nvmap_deferred_free_lock);
+		h = list_first_entry_or_null(&nvmap_deferred_free_list,
+					     struct nvmap_handle, lru);
+		if (h)
+			list_del_init(&h->lru);
+		spin_unlock(&nvmap_deferred_free_lock);
+
+		if (!h)
+			break;
+		nvmap_handle_release(h);
+	}
+}
+
+void _nvmap_handle_free(struct nvmap_handle *h)
+{
+	struct nvmap_handle_dmabuf_priv *curr, *next;
+
+	list_for_each_entry_safe(curr, next, &h->dmabuf_priv, list) {
+		curr->priv_release(curr->priv);
+		list_del(&curr->list);
+		kzfree(curr);
+	}
+
+	if (nvmap_handle_remove(nvmap_dev, h) != 0)
+		return;
+
+	/*
+	 * Returning the pages of a large handle to the pool and doing the
+	 * associated cache maintenance can take milliseconds; don't make the
+	 * caller (often a frame thread dropping its last reference) pay for
+	 * it. The handle is already out of the device tree at this point, so
+	 * its lru node is free to carry it to the worker.
+	 */
+	if (h->alloc && h->heap_pgalloc && !h->from_va &&
+	    h->size >= deferred_free_min_size) {
+		spin_lock(&nvmap_deferred_free_lock);
+		list_add_tail(&h->lru, &nvmap_deferred_free_list);
+		spin_unlock(&nvmap_deferred_free_lock);
+		queue_work(system_unbound_wq, &nvmap_deferred_free_work);
+		return;
+	}
+
+	nvmap_handle_release(h);
 }
 
 void nvmap_free_handle(struct nvmap_client *client,
@@ -167,10 +167,61 @@ void inner_cache_maint(unsigned int op, void *vaddr, size_t size)
 		__dma_map_area(vaddr, size, DMA_TO_DEVICE);
 }
 
+/*
+ * Clean only the extents of [start, end) dirtied since the last clean.
+ * Dirty state is recorded per page at fault time (and via the
+ * NVMAP_PAGES_MK_DIRTY hint); physically contiguous dirty pages are
+ * coalesced into a single maintenance call. Mappings are zapped first so
+ * that writes racing with the walk fault in and get tracked again.
+ */
+static void heap_page_cache_maint_dirty(
+	struct nvmap_handle *h, unsigned long start, unsigned long end,
+	unsigned int op, bool inner, bool outer)
+{
+	phys_addr_t run_start = 0, run_end = 0;
+	unsigned long addr;
+	int ret;
+
+	nvmap_zap_handle(h, start, end - start);
+
+	for (addr = start & PAGE_MASK; addr < end; addr += PAGE_SIZE) {
+		struct page **pagep = &h->pgalloc.pages[addr >> PAGE_SHIFT];
+		phys_addr_t paddr;
+
+		if (!nvmap_page_mkclean(pagep))
+			continue;
+		atomic_dec(&h->pgalloc.ndirty);
+
+		paddr = page_to_phys(nvmap_to_page(*pagep));
+		if (run_end && paddr == run_end) {
+			run_end += PAGE_SIZE;
+			continue;
+		}
+		if (run_end) {
+			ret = nvmap_cache_maint_phys_range(op, run_start,
+					run_end, inner, outer);
+			BUG_ON(ret != 0);
+		}
+		run_start = paddr;
+		run_end = paddr + PAGE_SIZE;
+	}
+
+	if (run_end) {
+		ret = nvmap_cache_maint_phys_range(op, run_start, run_end,
+				inner, outer);
+		BUG_ON(ret != 0);
+	}
+}
+
 static void heap_page_cache_maint(
 	struct nvmap_handle *h, unsigned long start, unsigned long end,
 	unsigned int op, bool inner, bool outer, bool clean_only_dirty)
 {
+	if (clean_only_dirty && nvmap_handle_track_dirty(h)) {
+		heap_page_cache_maint_dirty(h, start, end, op, inner, outer);
+		return;
+	}
+
 	if (h->userflags & NVMAP_HANDLE_CACHE_SYNC) {
 		/*
 		 * zap user VA->PA mappings so that any access to the pages
@@ -238,8 +289,20 @@ static bool fast_cache_maint(struct nvmap_handle *h,
 	unsigned long end, unsigned int op,
 	bool clean_only_dirty)
 {
-	if (!can_fast_cache_maint(start, end, op))
+	/*
+	 * With dirty tracking the amount of cache to maintain is bounded by
+	 * the dirty footprint, not the handle size; size the full-cache
+	 * shortcut decision accordingly.
+	 */
+	if (clean_only_dirty && nvmap_handle_track_dirty(h)) {
+		unsigned long dirty = (unsigned long)
+			atomic_read(&h->pgalloc.ndirty) << PAGE_SHIFT;
+
+		if (!can_fast_cache_maint(0, dirty, op))
+			return false;
+	} else if (!can_fast_cache_maint(start, end, op)) {
 		return false;
+	}
 
 	if (h->userflags & NVMAP_HANDLE_CACHE_SYNC) {
 		nvmap_handle_mkclean(h, 0, h->size);
@@ -458,8 +521,9 @@ int __nvmap_cache_maint(struct nvmap_client *client,
 		(vma->vm_pgoff << PAGE_SHIFT);
 	end = start + op->len;
 
+	/* Writebacks can be restricted to extents dirtied since last clean */
 	err = __nvmap_do_cache_maint(client, priv->handle, start, end, op->op,
-				     false);
+				     op->op == NVMAP_CACHE_OP_WB);
 out:
 	up_read(&current->mm->mmap_sem);
 	nvmap_handle_put(handle);
@@ -548,7 +612,8 @@ static int __nvmap_do_cache_maint_list(struct nvmap_handle **handles,
 			err = __nvmap_do_cache_maint(handles[i]->owner,
 						     handles[i], offset,
 						     offset + size,
-						     op, false);
+						     op,
+						     op == NVMAP_CACHE_OP_WB);
 			if (err) {
 				pr_err("cache maint per handle failed [%d]\n",
 						err);
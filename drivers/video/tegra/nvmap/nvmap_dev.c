@@ -372,6 +372,18 @@ static long nvmap_ioctl(struct file *filp, unsigned int cmd, unsigned long arg)
 		err = nvmap_ioctl_free(filp, arg);
 		break;
 
+	case NVMAP_IOC_BATCH_OP:
+		err = nvmap_ioctl_batch_op(filp, uarg);
+		break;
+
+	case NVMAP_IOC_HANDLE_SNAPSHOT:
+		err = nvmap_ioctl_handle_snapshot(filp, uarg);
+		break;
+
+	case NVMAP_IOC_PREFAULT:
+		err = nvmap_ioctl_prefault(filp, uarg);
+		break;
+
 #ifdef CONFIG_COMPAT
 	case NVMAP_IOC_WRITE_32:
 	case NVMAP_IOC_READ_32:
@@ -1216,6 +1228,7 @@ int __init nvmap_probe(struct platform_device *pdev)
 	dev->dev_user.fops = &nvmap_user_fops;
 	dev->dev_user.parent = &pdev->dev;
 	dev->handles = RB_ROOT;
+	hash_init(dev->handles_hash);
 
 	if (of_property_read_bool(pdev->dev.of_node,
 				"no-cache-maint-by-set-ways"))
@@ -1328,7 +1341,8 @@ int nvmap_remove(struct platform_device *pdev)
 	while ((n = rb_first(&dev->handles))) {
 		h = rb_entry(n, struct nvmap_handle, node);
 		rb_erase(&h->node, &dev->handles);
-		kfree(h);
+		hash_del_rcu(&h->hash_node);
+		kfree_rcu(h, rcu);
 	}
 
 	for (i = 0; i < dev->nr_carveouts; i++) {
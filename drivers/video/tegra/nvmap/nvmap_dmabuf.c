@@ -28,6 +28,7 @@
 #include <linux/seq_file.h>
 #include <linux/stringify.h>
 #include <linux/of.h>
+#include <linux/shrinker.h>
 #include <linux/platform/tegra/tegra_fd.h>
 #include <linux/version.h>
 #include <linux/iommu.h>
@@ -65,9 +66,15 @@ struct nvmap_handle_sgt {
 
 static DEFINE_MUTEX(nvmap_stashed_maps_lock);
 static LIST_HEAD(nvmap_stashed_maps);
+static atomic_long_t nvmap_stashed_pages;
 static struct kmem_cache *handle_sgt_cache;
 static struct dma_buf_ops nvmap_dma_buf_ops;
 
+static inline unsigned long nvmap_sgt_pages(struct nvmap_handle_sgt *nvmap_sgt)
+{
+	return nvmap_sgt->owner->handle->size >> PAGE_SHIFT;
+}
+
 static bool nvmap_attach_handle_same_asid(struct dma_buf_attachment *attach,
 					struct nvmap_handle_sgt *nvmap_sgt)
 {
@@ -75,6 +82,58 @@ static bool nvmap_attach_handle_same_asid(struct dma_buf_attachment *attach,
 
 }
 
+static void __nvmap_dmabuf_free_sgt_locked(struct nvmap_handle_sgt *nvmap_sgt);
+static void __nvmap_dmabuf_evict_stash_locked(
+			struct nvmap_handle_sgt *nvmap_sgt);
+
+static unsigned long nvmap_dmabuf_stash_count_objects(struct shrinker *shrinker,
+						      struct shrink_control *sc)
+{
+	return atomic_long_read(&nvmap_stashed_pages);
+}
+
+/*
+ * Reclaim stashed (lazily unmapped) IOVA mappings, oldest first. Lock order
+ * elsewhere is maps_lock -> stash lock, so the owner's maps_lock is only
+ * trylock'd here; contended entries are skipped and revisited on the next
+ * scan.
+ */
+static unsigned long nvmap_dmabuf_stash_scan_objects(struct shrinker *shrinker,
+						     struct shrink_control *sc)
+{
+	struct nvmap_handle_sgt *nvmap_sgt, *tmp;
+	unsigned long freed = 0;
+
+	if (!mutex_trylock(&nvmap_stashed_maps_lock))
+		return SHRINK_STOP;
+
+	list_for_each_entry_safe(nvmap_sgt, tmp, &nvmap_stashed_maps,
+				 stash_entry) {
+		struct nvmap_handle_info *info = nvmap_sgt->owner;
+
+		if (freed >= sc->nr_to_scan)
+			break;
+
+		if (!mutex_trylock(&info->maps_lock))
+			continue;
+
+		freed += nvmap_sgt_pages(nvmap_sgt);
+		__nvmap_dmabuf_evict_stash_locked(nvmap_sgt);
+		__nvmap_dmabuf_free_sgt_locked(nvmap_sgt);
+		mutex_unlock(&info->maps_lock);
+	}
+
+	mutex_unlock(&nvmap_stashed_maps_lock);
+
+	return freed ? freed : SHRINK_STOP;
+}
+
+static struct shrinker nvmap_dmabuf_stash_shrinker = {
+	.count_objects = nvmap_dmabuf_stash_count_objects,
+	.scan_objects = nvmap_dmabuf_stash_scan_objects,
+	.seeks = 1,
+};
+
 /*
  * Initialize a kmem cache for allocating nvmap_handle_sgt's.
  */
@@ -86,6 +145,8 @@ int nvmap_dmabuf_stash_init(void)
 		return -ENOMEM;
 	}
 
+	register_shrinker(&nvmap_dmabuf_stash_shrinker);
+
 	return 0;
 }
 
@@ -124,6 +185,7 @@ static void __nvmap_dmabuf_del_stash(struct nvmap_handle_sgt *nvmap_sgt)
 
 	pr_debug("Removing map from stash.\n");
 	list_del_init(&nvmap_sgt->stash_entry);
+	atomic_long_sub(nvmap_sgt_pages(nvmap_sgt), &nvmap_stashed_pages);
 	mutex_unlock(&nvmap_stashed_maps_lock);
 }
 
@@ -179,8 +241,11 @@ static void __nvmap_dmabuf_free_sgt_locked(struct nvmap_handle_sgt *nvmap_sgt)
 static void __nvmap_dmabuf_evict_stash_locked(
 			struct nvmap_handle_sgt *nvmap_sgt)
 {
-	if (!list_empty(&nvmap_sgt->stash_entry))
+	if (!list_empty(&nvmap_sgt->stash_entry)) {
 		list_del_init(&nvmap_sgt->stash_entry);
+		atomic_long_sub(nvmap_sgt_pages(nvmap_sgt),
+				&nvmap_stashed_pages);
+	}
 }
 
 /*
@@ -238,7 +303,18 @@ static void __nvmap_dmabuf_stash_sgt_locked(struct dma_buf_attachment *attach,
 			if (!atomic_sub_and_test(1, &nvmap_sgt->refs))
 				goto done;
 
-			__nvmap_dmabuf_free_sgt_locked(nvmap_sgt);
+			/*
+			 * Lazy unmap: keep the IOVA mapping alive on the
+			 * stash LRU so the next map from the same domain is
+			 * a cache hit. The shrinker reclaims stashed maps
+			 * under memory pressure.
+			 */
+			mutex_lock(&nvmap_stashed_maps_lock);
+			list_add_tail(&nvmap_sgt->stash_entry,
+				      &nvmap_stashed_maps);
+			atomic_long_add(nvmap_sgt_pages(nvmap_sgt),
+					&nvmap_stashed_pages);
+			mutex_unlock(&nvmap_stashed_maps_lock);
 			goto done;
 		}
 	}
@@ -17,6 +17,7 @@
 
 #include <trace/events/nvmap.h>
 #include <linux/highmem.h>
+#include <linux/moduleparam.h>
 
 #include "nvmap_priv.h"
 
@@ -41,6 +42,125 @@ int is_nvmap_vma(struct vm_area_struct *vma)
 	return vma->vm_ops == &nvmap_vma_ops;
 }
 
+/* extra PTEs installed per fault on handles without dirty tracking */
+static unsigned int fault_around_pages = 16;
+module_param(fault_around_pages, uint, 0644);
+
+/*
+ * Install PTEs for the pages following the faulting one, so a linear
+ * first pass over a freshly mapped handle takes one fault per
+ * fault_around_pages instead of one per page. Only used for handles
+ * without dirty tracking; tracked handles need their per-page cache
+ * maintenance and accounting on the fault path.
+ */
+static void nvmap_fault_around(struct vm_area_struct *vma,
+			       unsigned long fault_addr,
+			       struct nvmap_vma_priv *priv,
+			       unsigned long pgidx)
+{
+	struct nvmap_handle *h = priv->handle;
+	unsigned long nr_pages = h->size >> PAGE_SHIFT;
+	unsigned long addr = fault_addr + PAGE_SIZE;
+	unsigned int i;
+
+	for (i = 1; i < fault_around_pages; i++, addr += PAGE_SIZE) {
+		struct page *page;
+
+		if (pgidx + i >= nr_pages || addr >= vma->vm_end)
+			break;
+		page = nvmap_to_page(h->pgalloc.pages[pgidx + i]);
+		if (vm_insert_page(vma, addr, page))
+			break;
+	}
+}
+
+int nvmap_prefault_user_range(unsigned long va, size_t len)
+{
+	struct mm_struct *mm = current->mm;
+	struct vm_area_struct *vma;
+	struct nvmap_vma_priv *priv;
+	struct nvmap_handle *h;
+	unsigned long addr, offs;
+	int err = 0;
+
+	if (!len || (va | len) & ~PAGE_MASK)
+		return -EINVAL;
+
+	down_read(&mm->mmap_sem);
+	vma = find_vma(mm, va);
+	if (!vma || va < vma->vm_start || va + len > vma->vm_end ||
+	    !is_nvmap_vma(vma)) {
+		err = -EINVAL;
+		goto unlock;
+	}
+
+	priv = vma->vm_private_data;
+	if (!priv || !priv->handle || !priv->handle->alloc) {
+		err = -EINVAL;
+		goto unlock;
+	}
+	h = priv->handle;
+
+	/* batch the dirty accounting and cache maintenance up front */
+	if (h->heap_pgalloc && nvmap_handle_track_dirty(h)) {
+		mutex_lock(&h->lock);
+		for (addr = va; addr < va + len; addr += PAGE_SIZE) {
+			offs = (addr - vma->vm_start) + priv->offs +
+				(vma->vm_pgoff << PAGE_SHIFT);
+			if (offs >= h->size)
+				break;
+			offs >>= PAGE_SHIFT;
+			if (nvmap_page_dirty(h->pgalloc.pages[offs]))
+				continue;
+			inner_cache_maint(NVMAP_CACHE_OP_WB_INV,
+				kmap(nvmap_to_page(h->pgalloc.pages[offs])),
+				PAGE_SIZE);
+			kunmap(nvmap_to_page(h->pgalloc.pages[offs]));
+			nvmap_page_mkdirty(&h->pgalloc.pages[offs]);
+			atomic_inc(&h->pgalloc.ndirty);
+		}
+		mutex_unlock(&h->lock);
+	}
+
+	for (addr = va; addr < va + len; addr += PAGE_SIZE) {
+		offs = (addr - vma->vm_start) + priv->offs +
+			(vma->vm_pgoff << PAGE_SHIFT);
+		if (offs >= h->size) {
+			err = -EINVAL;
+			break;
+		}
+
+		if (!h->heap_pgalloc) {
+			unsigned long pfn =
+				(h->carveout->base + offs) >> PAGE_SHIFT;
+
+			if (!pfn_valid(pfn)) {
+				err = vm_insert_pfn(vma, addr, pfn);
+				if (err && err != -EBUSY)
+					break;
+				err = 0;
+				continue;
+			}
+			err = vm_insert_page(vma, addr, pfn_to_page(pfn));
+		} else {
+			if (atomic_read(&h->pgalloc.reserved)) {
+				err = -EINVAL;
+				break;
+			}
+			err = vm_insert_page(vma, addr,
+				nvmap_to_page(
+					h->pgalloc.pages[offs >> PAGE_SHIFT]));
+		}
+		if (err == -EBUSY)
+			err = 0;	/* already mapped */
+		else if (err)
+			break;
+	}
+unlock:
+	up_read(&mm->mmap_sem);
+	return err;
+}
+
 /* to ensure that the backing store for the VMA isn't freed while a fork'd
  * reference still exists, nvmap_vma_open increments the reference count on
  * the handle, and nvmap_vma_close decrements it. alternatively, we could
@@ -222,8 +342,13 @@ static int nvmap_vma_fault(struct vm_area_struct *vma, struct vm_fault *vmf)
 			return VM_FAULT_SIGBUS;
 		page = nvmap_to_page(priv->handle->pgalloc.pages[offs]);
 
-		if (!nvmap_handle_track_dirty(priv->handle))
+		if (!nvmap_handle_track_dirty(priv->handle)) {
+			if (fault_around_pages > 1)
+				nvmap_fault_around(vma,
+					(unsigned long)vmf_address,
+					priv, offs);
 			goto finish;
+		}
 
 		mutex_lock(&priv->handle->lock);
 		if (nvmap_page_dirty(priv->handle->pgalloc.pages[offs])) {
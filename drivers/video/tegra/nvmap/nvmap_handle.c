@@ -79,6 +79,7 @@ void nvmap_handle_add(struct nvmap_device *dev, struct nvmap_handle *h)
 	}
 	rb_link_node(&h->node, parent, p);
 	rb_insert_color(&h->node, &dev->handles);
+	hash_add_rcu(dev->handles_hash, &h->hash_node, (unsigned long)h);
 	nvmap_lru_add(h);
 	spin_unlock(&dev->handle_lock);
 }
@@ -101,35 +102,32 @@ int nvmap_handle_remove(struct nvmap_device *dev, struct nvmap_handle *h)
 
 	nvmap_lru_del(h);
 	rb_erase(&h->node, &dev->handles);
+	hash_del_rcu(&h->hash_node);
 
 	spin_unlock(&dev->handle_lock);
 	return 0;
 }
 
 /* Validates that a handle is in the device master tree and that the
- * client has permission to access it. */
+ * client has permission to access it. Runs under RCU so the hot lookup
+ * path (every ioctl, submit and dma-buf op) never touches handle_lock;
+ * handles are freed via kfree_rcu and the ref is only taken when it is
+ * provably non-zero. */
 struct nvmap_handle *nvmap_validate_get(struct nvmap_handle *id)
 {
-	struct nvmap_handle *h = NULL;
-	struct rb_node *n;
-
-	spin_lock(&nvmap_dev->handle_lock);
-
-	n = nvmap_dev->handles.rb_node;
+	struct nvmap_handle *h;
 
-	while (n) {
-		h = rb_entry(n, struct nvmap_handle, node);
-		if (h == id) {
-			h = nvmap_handle_get(h);
-			spin_unlock(&nvmap_dev->handle_lock);
-			return h;
-		}
-		if (id > h)
-			n = n->rb_right;
-		else
-			n = n->rb_left;
+	rcu_read_lock();
+	hash_for_each_possible_rcu(nvmap_dev->handles_hash, h, hash_node,
+				   (unsigned long)id) {
+		if (h != id)
+			continue;
+		if (!atomic_inc_not_zero(&h->ref))
+			break;
+		rcu_read_unlock();
+		return h;
 	}
-	spin_unlock(&nvmap_dev->handle_lock);
+	rcu_read_unlock();
 	return NULL;
 }
 
@@ -80,6 +80,17 @@ struct nvmap_heap {
 	int peer; /* Used only if is_ivm == true */
 	int vm_id; /* Used only if is_ivm == true */
 	struct nvmap_pm_ops pm_ops;
+	/*
+	 * Page-granule bitmap allocator for static (non-IVM, non-resizable)
+	 * carveouts. Replaces the per-allocation trip through the DMA
+	 * coherent allocator, whose search restarts from the bottom of the
+	 * region and degrades as the carveout fills; next_fit keeps the scan
+	 * rolling from the last allocation instead.
+	 */
+	unsigned long *bitmap;
+	size_t nr_pages;
+	unsigned long next_fit;
+	size_t free_pages;
 };
 
 struct device *dma_dev_from_handle(unsigned long type)
@@ -128,6 +139,43 @@ void nvmap_heap_debugfs_init(struct dentry *heap_root, struct nvmap_heap *heap)
 	else
 		debugfs_create_x32("size", S_IRUGO,
 			heap_root, (u32 *)&heap->len);
+	if (heap->bitmap)
+		debugfs_create_size_t("free_pages", S_IRUGO,
+			heap_root, &heap->free_pages);
+}
+
+static phys_addr_t nvmap_bitmap_alloc_mem(struct nvmap_heap *h, size_t len,
+					  size_t align)
+{
+	unsigned long npages = DIV_ROUND_UP(len, PAGE_SIZE);
+	unsigned long align_mask = (align >> PAGE_SHIFT) - 1;
+	unsigned long bit;
+
+	bit = bitmap_find_next_zero_area(h->bitmap, h->nr_pages, h->next_fit,
+					 npages, align_mask);
+	if (bit >= h->nr_pages) {
+		/* wrap around: retry below the rolling hint */
+		bit = bitmap_find_next_zero_area(h->bitmap, h->nr_pages, 0,
+						 npages, align_mask);
+		if (bit >= h->nr_pages)
+			return DMA_ERROR_CODE;
+	}
+
+	bitmap_set(h->bitmap, bit, npages);
+	h->next_fit = bit + npages;
+	h->free_pages -= npages;
+
+	return h->base + ((phys_addr_t)bit << PAGE_SHIFT);
+}
+
+static void nvmap_bitmap_free_mem(struct nvmap_heap *h, phys_addr_t base,
+				  size_t len)
+{
+	unsigned long npages = DIV_ROUND_UP(len, PAGE_SIZE);
+	unsigned long bit = (base - h->base) >> PAGE_SHIFT;
+
+	bitmap_clear(h->bitmap, bit, npages);
+	h->free_pages += npages;
 }
 
 static phys_addr_t nvmap_alloc_mem(struct nvmap_heap *h, size_t len,
@@ -234,7 +282,12 @@ static struct nvmap_heap_block *do_heap_alloc(struct nvmap_heap *heap,
 		goto fail_heap_block_alloc;
 	}
 
-	dev_base = nvmap_alloc_mem(heap, len, start);
+	if (heap->bitmap) {
+		align = max_t(size_t, align, PAGE_SIZE);
+		dev_base = nvmap_bitmap_alloc_mem(heap, len, align);
+	} else {
+		dev_base = nvmap_alloc_mem(heap, len, start);
+	}
 	if (dma_mapping_error(dev, dev_base)) {
 		dev_err(dev, "failed to alloc mem of size (%zu)\n",
 			len);
@@ -271,7 +324,10 @@ static struct list_block *do_heap_free(struct nvmap_heap_block *block)
 
 	list_del(&b->all_list);
 
-	nvmap_free_mem(heap, block->base, b->size);
+	if (heap->bitmap)
+		nvmap_bitmap_free_mem(heap, block->base, b->size);
+	else
+		nvmap_free_mem(heap, block->base, b->size);
 	kmem_cache_free(heap_block_cache, b);
 
 	return b;
@@ -452,6 +508,26 @@ struct nvmap_heap *nvmap_heap_create(struct device *parent,
 
 	INIT_LIST_HEAD(&h->all_list);
 	mutex_init(&h->lock);
+
+	/*
+	 * Static carveouts are managed by the in-heap bitmap allocator.
+	 * Resizable (CMA) heaps and IVM heaps keep the DMA path: their
+	 * backing range is not fully owned by nvmap. True compaction is not
+	 * possible here - blocks are handed to hardware by physical address
+	 * and can not move - so fighting fragmentation is limited to the
+	 * alignment-aware fit below.
+	 */
+	if (!h->cma_dev && !h->is_ivm &&
+	    PAGE_ALIGNED(h->base) && PAGE_ALIGNED(h->len)) {
+		h->nr_pages = h->len >> PAGE_SHIFT;
+		h->bitmap = kcalloc(BITS_TO_LONGS(h->nr_pages),
+				    sizeof(unsigned long), GFP_KERNEL);
+		if (h->bitmap)
+			h->free_pages = h->nr_pages;
+		else
+			h->nr_pages = 0;
+	}
+
 	if (!co->no_cpu_access &&
 		nvmap_cache_maint_phys_range(NVMAP_CACHE_OP_WB_INV,
 				base, base + len, true, true)) {
@@ -470,6 +546,7 @@ struct nvmap_heap *nvmap_heap_create(struct device *parent,
 		co->name, (void *)(uintptr_t)base, len/1024);
 	return h;
 fail:
+	kfree(h->bitmap);
 	kfree(h);
 	return NULL;
 }
@@ -485,6 +562,7 @@ void nvmap_heap_destroy(struct nvmap_heap *heap)
 		list_del(&l->all_list);
 		kmem_cache_free(heap_block_cache, l);
 	}
+	kfree(heap->bitmap);
 	kfree(heap);
 }
 
@@ -18,11 +18,14 @@
 #define pr_fmt(fmt)	"nvmap: %s() " fmt, __func__
 
 #include <linux/dma-mapping.h>
+#include <linux/dmaengine.h>
 #include <linux/export.h>
 #include <linux/fs.h>
 #include <linux/io.h>
 #include <linux/kernel.h>
 #include <linux/list.h>
+#include <linux/moduleparam.h>
+#include <linux/scatterlist.h>
 #include <linux/slab.h>
 #include <linux/uaccess.h>
 #include <linux/nvmap.h>
@@ -42,6 +45,215 @@
 
 extern struct device tegra_vpr_dev;
 
+#ifdef CONFIG_TEGRA186_GPC_DMA
+/*
+ * Contiguous transfers at least this big bypass the CPU copy loop: the
+ * user buffer is pinned with get_user_pages and the data is moved by the
+ * GPC-DMA memcpy engine. Large model-weight uploads were burning a full
+ * core in memcpy through the handle's kernel mapping.
+ */
+static u32 rw_dma_threshold = SZ_1M;
+module_param(rw_dma_threshold, uint, 0644);
+
+static struct dma_chan *nvmap_rw_dma_chan;
+static DEFINE_MUTEX(nvmap_rw_dma_lock);
+
+/* call with nvmap_rw_dma_lock held */
+static struct dma_chan *nvmap_rw_dma_get_chan(void)
+{
+	dma_cap_mask_t mask;
+
+	if (nvmap_rw_dma_chan)
+		return nvmap_rw_dma_chan;
+
+	dma_cap_zero(mask);
+	dma_cap_set(DMA_MEMCPY, mask);
+	nvmap_rw_dma_chan = dma_request_channel(mask, NULL, NULL);
+	return nvmap_rw_dma_chan;
+}
+
+/*
+ * Move [h_offs, h_offs + size) of the handle to/from the pinned user
+ * buffer at sys_addr with the memcpy DMA engine. Both sides are mapped
+ * as scatterlists for the DMA device (which also takes care of CPU cache
+ * maintenance) and one memcpy descriptor is queued per overlapping
+ * contiguous run; completion is awaited on the last cookie only.
+ *
+ * Returns bytes moved, or -errno; the caller falls back to the CPU copy
+ * loop on any error.
+ */
+static ssize_t rw_handle_dma(struct nvmap_handle *h, int is_read,
+			     unsigned long h_offs, unsigned long sys_addr,
+			     unsigned long size)
+{
+	struct sg_table usgt, hsgt;
+	struct scatterlist *usg, *hsg;
+	struct page **user_pages, **handle_pages;
+	struct dma_chan *chan;
+	struct device *dev;
+	dma_cookie_t cookie = 0;
+	unsigned long nr_upages, nr_hpages, uoff;
+	unsigned long u_avail = 0, h_avail = 0;
+	dma_addr_t u_addr = 0, h_addr = 0;
+	long pinned;
+	ssize_t ret = 0;
+	unsigned long i;
+
+	mutex_lock(&nvmap_rw_dma_lock);
+
+	chan = nvmap_rw_dma_get_chan();
+	if (!chan) {
+		ret = -ENODEV;
+		goto unlock;
+	}
+	dev = chan->device->dev;
+
+	uoff = sys_addr & ~PAGE_MASK;
+	nr_upages = DIV_ROUND_UP(uoff + size, PAGE_SIZE);
+	nr_hpages = ((h_offs + size - 1) >> PAGE_SHIFT) -
+		    (h_offs >> PAGE_SHIFT) + 1;
+
+	user_pages = nvmap_altalloc(nr_upages * sizeof(*user_pages));
+	if (!user_pages) {
+		ret = -ENOMEM;
+		goto unlock;
+	}
+	handle_pages = nvmap_altalloc(nr_hpages * sizeof(*handle_pages));
+	if (!handle_pages) {
+		ret = -ENOMEM;
+		goto free_upages;
+	}
+
+	pinned = get_user_pages_fast(sys_addr & PAGE_MASK, nr_upages,
+				     is_read, user_pages);
+	if (pinned != nr_upages) {
+		for (i = 0; i < pinned; i++)
+			put_page(user_pages[i]);
+		ret = -EFAULT;
+		goto free_hpages;
+	}
+
+	for (i = 0; i < nr_hpages; i++)
+		handle_pages[i] =
+			nvmap_to_page(h->pgalloc.pages[(h_offs >> PAGE_SHIFT) + i]);
+
+	ret = sg_alloc_table_from_pages(&usgt, user_pages, nr_upages,
+					uoff, size, GFP_KERNEL);
+	if (ret)
+		goto put_upages;
+	ret = sg_alloc_table_from_pages(&hsgt, handle_pages, nr_hpages,
+					h_offs & ~PAGE_MASK, size, GFP_KERNEL);
+	if (ret)
+		goto free_usgt;
+
+	if (!dma_map_sg(dev, usgt.sgl, usgt.nents,
+			is_read ? DMA_FROM_DEVICE : DMA_TO_DEVICE)) {
+		ret = -ENOMEM;
+		goto free_hsgt;
+	}
+	if (!dma_map_sg(dev, hsgt.sgl, hsgt.nents,
+			is_read ? DMA_TO_DEVICE : DMA_FROM_DEVICE)) {
+		ret = -ENOMEM;
+		goto unmap_usgt;
+	}
+
+	usg = usgt.sgl;
+	hsg = hsgt.sgl;
+	while (size) {
+		struct dma_async_tx_descriptor *desc;
+		unsigned long len;
+
+		if (!u_avail) {
+			u_addr = sg_dma_address(usg);
+			u_avail = sg_dma_len(usg);
+		}
+		if (!h_avail) {
+			h_addr = sg_dma_address(hsg);
+			h_avail = sg_dma_len(hsg);
+		}
+
+		len = min3(u_avail, h_avail, size);
+		desc = dmaengine_prep_dma_memcpy(chan,
+				is_read ? u_addr : h_addr,
+				is_read ? h_addr : u_addr,
+				len, DMA_PREP_INTERRUPT);
+		if (!desc) {
+			ret = -EIO;
+			break;
+		}
+		cookie = dmaengine_submit(desc);
+		if (dma_submit_error(cookie)) {
+			ret = -EIO;
+			break;
+		}
+
+		u_addr += len;
+		h_addr += len;
+		u_avail -= len;
+		h_avail -= len;
+		size -= len;
+		ret += len;
+		if (!u_avail)
+			usg = sg_next(usg);
+		if (!h_avail)
+			hsg = sg_next(hsg);
+	}
+
+	if (cookie > 0) {
+		dma_async_issue_pending(chan);
+		if (dma_sync_wait(chan, cookie) != DMA_COMPLETE)
+			ret = -EIO;
+	}
+
+	dma_unmap_sg(dev, hsgt.sgl, hsgt.nents,
+		     is_read ? DMA_TO_DEVICE : DMA_FROM_DEVICE);
+unmap_usgt:
+	dma_unmap_sg(dev, usgt.sgl, usgt.nents,
+		     is_read ? DMA_FROM_DEVICE : DMA_TO_DEVICE);
+free_hsgt:
+	sg_free_table(&hsgt);
+free_usgt:
+	sg_free_table(&usgt);
+put_upages:
+	for (i = 0; i < nr_upages; i++) {
+		if (is_read && ret > 0)
+			set_page_dirty_lock(user_pages[i]);
+		put_page(user_pages[i]);
+	}
+free_hpages:
+	nvmap_altfree(handle_pages, nr_hpages * sizeof(*handle_pages));
+free_upages:
+	nvmap_altfree(user_pages, nr_upages * sizeof(*user_pages));
+unlock:
+	mutex_unlock(&nvmap_rw_dma_lock);
+	return ret;
+}
+
+static bool rw_handle_dma_eligible(struct nvmap_handle *h,
+				   unsigned long elem_size,
+				   unsigned long count)
+{
+	return count == 1 && rw_dma_threshold &&
+	       elem_size >= rw_dma_threshold &&
+	       h->heap_pgalloc && !h->from_va &&
+	       h->heap_type != NVMAP_HEAP_CARVEOUT_VPR;
+}
+#else
+static ssize_t rw_handle_dma(struct nvmap_handle *h, int is_read,
+			     unsigned long h_offs, unsigned long sys_addr,
+			     unsigned long size)
+{
+	return -ENODEV;
+}
+
+static bool rw_handle_dma_eligible(struct nvmap_handle *h,
+				   unsigned long elem_size,
+				   unsigned long count)
+{
+	return false;
+}
+#endif /* CONFIG_TEGRA186_GPC_DMA */
+
 static ssize_t rw_handle(struct nvmap_client *client, struct nvmap_handle *h,
 			 int is_read, unsigned long h_offs,
 			 unsigned long sys_addr, unsigned long h_stride,
@@ -175,6 +387,163 @@ int nvmap_ioctl_alloc_ivm(struct file *filp, void __user *arg)
 	return err;
 }
 
+/*
+ * Vectored handle setup/teardown. The camera/CUDA pipelines allocate and
+ * free dozens of handles per frame; doing that through one syscall instead
+ * of one per handle keeps handle-table cost out of the frame budget. Each
+ * descriptor carries its own result so one failing operation does not
+ * abort the rest of the batch.
+ */
+int nvmap_ioctl_batch_op(struct file *filp, void __user *arg)
+{
+	struct nvmap_client *client = filp->private_data;
+	struct nvmap_batch_op_list op;
+	struct nvmap_batch_op *ops;
+	size_t bytes;
+	u32 i;
+	int err = 0;
+
+	if (copy_from_user(&op, arg, sizeof(op)))
+		return -EFAULT;
+
+	if (!op.nr || op.nr > NVMAP_BATCH_OP_MAX_NR || op.reserved)
+		return -EINVAL;
+
+	bytes = op.nr * sizeof(*ops);
+	ops = nvmap_altalloc(bytes);
+	if (!ops)
+		return -ENOMEM;
+
+	if (copy_from_user(ops, (void __user *)(uintptr_t)op.ops, bytes)) {
+		nvmap_altfree(ops, bytes);
+		return -EFAULT;
+	}
+
+	for (i = 0; i < op.nr; i++) {
+		struct nvmap_handle *handle;
+
+		switch (ops[i].op) {
+		case NVMAP_BATCH_OP_ALLOC:
+			if (ops[i].align & (ops[i].align - 1)) {
+				ops[i].result = -EINVAL;
+				break;
+			}
+
+			handle = nvmap_handle_get_from_fd(ops[i].handle);
+			if (!handle) {
+				ops[i].result = -EINVAL;
+				break;
+			}
+
+			/* user-space handles are aligned to page boundaries,
+			 * to prevent data leakage. */
+			ops[i].result = nvmap_alloc_handle(client, handle,
+					ops[i].heap_mask,
+					max_t(size_t, ops[i].align, PAGE_SIZE),
+					0, /* no kind */
+					ops[i].flags &
+						(~NVMAP_HANDLE_KIND_SPECIFIED),
+					NVMAP_IVM_INVALID_PEER);
+			nvmap_handle_put(handle);
+			break;
+		case NVMAP_BATCH_OP_FREE:
+			if (!ops[i].handle) {
+				ops[i].result = 0;
+				break;
+			}
+			nvmap_free_handle_fd(client, ops[i].handle);
+			ops[i].result = sys_close(ops[i].handle);
+			break;
+		default:
+			ops[i].result = -EINVAL;
+			break;
+		}
+	}
+
+	if (copy_to_user((void __user *)(uintptr_t)op.ops, ops, bytes))
+		err = -EFAULT;
+
+	nvmap_altfree(ops, bytes);
+	return err;
+}
+
+/*
+ * Device-wide ownership snapshot: one pass over the handle tree under
+ * handle_lock into a kernel staging array, then one copy_to_user. A
+ * profiler gets a consistent (tag, size, heap, pins, owner) map in a
+ * single syscall instead of stalling the allocator once per handle.
+ */
+int nvmap_ioctl_handle_snapshot(struct file *filp, void __user *arg)
+{
+	struct nvmap_handle_snapshot op;
+	struct nvmap_handle_record *recs;
+	struct rb_node *n;
+	size_t bytes;
+	u32 filled = 0, total = 0;
+	int err = 0;
+
+	if (copy_from_user(&op, arg, sizeof(op)))
+		return -EFAULT;
+
+	if (!op.nr || op.nr > SZ_1M)
+		return -EINVAL;
+
+	bytes = op.nr * sizeof(*recs);
+	recs = nvmap_altalloc(bytes);
+	if (!recs)
+		return -ENOMEM;
+
+	spin_lock(&nvmap_dev->handle_lock);
+	for (n = rb_first(&nvmap_dev->handles); n; n = rb_next(n)) {
+		struct nvmap_handle *h =
+			rb_entry(n, struct nvmap_handle, node);
+
+		total++;
+		if (filled >= op.nr)
+			continue;
+
+		recs[filled].size = h->size;
+		recs[filled].tag = h->userflags >> 16;
+		recs[filled].heap_type = h->heap_type;
+		recs[filled].pin_count = atomic_read(&h->pin);
+		recs[filled].share_count = atomic_read(&h->share_count);
+		recs[filled].owner_pid = (h->owner && h->owner->task) ?
+			task_pid_nr(h->owner->task) : -1;
+		recs[filled].reserved = 0;
+		filled++;
+	}
+	spin_unlock(&nvmap_dev->handle_lock);
+
+	if (copy_to_user((void __user *)(uintptr_t)op.records, recs,
+			 filled * sizeof(*recs))) {
+		err = -EFAULT;
+		goto out;
+	}
+
+	op.nr = filled;
+	op.total = total;
+	if (copy_to_user(arg, &op, sizeof(op)))
+		err = -EFAULT;
+
+out:
+	nvmap_altfree(recs, bytes);
+	return err;
+}
+
+int nvmap_ioctl_prefault(struct file *filp, void __user *arg)
+{
+	struct nvmap_prefault op;
+
+	if (copy_from_user(&op, arg, sizeof(op)))
+		return -EFAULT;
+
+	if (op.va + op.len < op.va)
+		return -EINVAL;
+
+	return nvmap_prefault_user_range((unsigned long)op.va,
+					 (size_t)op.len);
+}
+
 int nvmap_ioctl_vpr_floor_size(struct file *filp, void __user *arg)
 {
 	int err=0;
@@ -483,6 +852,16 @@ static ssize_t rw_handle(struct nvmap_client *client, struct nvmap_handle *h,
 		h_offs + h_stride * (count - 1) + elem_size > h->size)
 		return -EINVAL;
 
+	if (rw_handle_dma_eligible(h, elem_size, count)) {
+		ssize_t dma_copied;
+
+		dma_copied = rw_handle_dma(h, is_read, h_offs, sys_addr,
+					   elem_size);
+		if (dma_copied >= 0)
+			return dma_copied;
+		/* fall back to the CPU copy loop */
+	}
+
 	if (!h->vaddr) {
 		if (!__nvmap_mmap(h))
 			return -ENOMEM;
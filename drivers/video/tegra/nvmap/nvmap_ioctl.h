@@ -39,6 +39,12 @@ int nvmap_ioctl_vpr_floor_size(struct file *filp, void __user *arg);
 
 int nvmap_ioctl_free(struct file *filp, unsigned long arg);
 
+int nvmap_ioctl_batch_op(struct file *filp, void __user *arg);
+
+int nvmap_ioctl_handle_snapshot(struct file *filp, void __user *arg);
+
+int nvmap_ioctl_prefault(struct file *filp, void __user *arg);
+
 int nvmap_ioctl_create(struct file *filp, unsigned int cmd, void __user *arg);
 
 int nvmap_ioctl_create_from_va(struct file *filp, void __user *arg);
@@ -190,6 +190,26 @@ int nvmap_reserve_pages(struct nvmap_handle **handles, u64 *offsets, u64 *sizes,
 	int i, err;
 	u32 *offs_32 = (u32 *)offsets, *sizes_32 = (u32 *)sizes;
 
+	/*
+	 * Dirty hint from userspace for ranges written without faulting
+	 * (e.g. through a long-lived writable mapping). Only records state;
+	 * the ranges are cleaned by the next dirty-aware cache operation.
+	 */
+	if (op == NVMAP_PAGES_MK_DIRTY) {
+		for (i = 0; i < nr; i++) {
+			u64 size = is_32 ? sizes_32[i] : sizes[i];
+			u64 offset = is_32 ? offs_32[i] : offsets[i];
+
+			size = size ?: handles[i]->size;
+			if ((offset >= handles[i]->size) ||
+			    (size > handles[i]->size - offset))
+				return -EINVAL;
+			if (nvmap_handle_track_dirty(handles[i]))
+				_nvmap_handle_mkdirty(handles[i], offset, size);
+		}
+		return 0;
+	}
+
 	for (i = 0; i < nr; i++) {
 		u64 size = is_32 ? sizes_32[i] : sizes[i];
 		u64 offset = is_32 ? offs_32[i] : offsets[i];
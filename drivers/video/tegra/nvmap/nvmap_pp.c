@@ -18,6 +18,7 @@
 #define pr_fmt(fmt) "%s: " fmt, __func__
 
 #include <linux/kernel.h>
+#include <linux/percpu.h>
 #include <linux/vmalloc.h>
 #include <linux/moduleparam.h>
 #include <linux/nodemask.h>
@@ -27,6 +28,7 @@
 #include <linux/freezer.h>
 #include <linux/highmem.h>
 #include <linux/version.h>
+#include <soc/tegra/chip-id.h>
 
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
 #include <linux/sched/clock.h>
@@ -38,12 +40,55 @@
 #include "nvmap_priv.h"
 
 #define NVMAP_TEST_PAGE_POOL_SHRINKER     1
-#define PENDING_PAGES_SIZE                (SZ_1M / PAGE_SIZE)
+/*
+ * Zeroing batch; must cover at least one big page so 2MB runs can still
+ * coalesce in __nvmap_page_pool_fill_lots_locked().
+ */
+#define PENDING_PAGES_SIZE                (SZ_2M / PAGE_SIZE)
+#define NVMAP_PP_MAGAZINE_SIZE            64
+
+/*
+ * Per-CPU magazine tier sitting in front of the global pool. The common
+ * alloc/free paths only touch the local CPU's magazine under its own
+ * (effectively uncontended) lock; the global pool->lock is taken once per
+ * magazine-sized batch for refill/flush instead of once per allocation.
+ * Zeroed magazines hold pages ready for allocation and are fed by the
+ * background zeroing thread; dirty magazines stage freed pages until a
+ * batch can be pushed to the pool's zero list.
+ */
+struct nvmap_pp_magazine {
+	spinlock_t lock;
+	u32 nr;
+	struct page *pages[NVMAP_PP_MAGAZINE_SIZE];
+};
+
+static struct nvmap_pp_magazine __percpu *pp_zeroed_mags;
+static struct nvmap_pp_magazine __percpu *pp_dirty_mags;
+
+#define NVMAP_PP_MAX_ZERO_THREADS         8
 
 static bool enable_pp = 1;
 static u32 pool_size;
 
-static struct task_struct *background_allocator;
+/*
+ * Pages the shrinker leaves in the pool under ordinary pressure, so a
+ * latency-critical pipeline's allocations keep hitting the pool while
+ * background reclaim proceeds. Set to 0 to restore drain-to-empty.
+ * The pool is still fully drained by explicit clears (disabling the
+ * pool, resize) and the OOM path reaches it via repeated scans.
+ */
+static u32 pool_reserve_pages = 1024;
+module_param(pool_reserve_pages, uint, 0644);
+
+/*
+ * Number of background zeroing threads. One thread cannot keep up with a
+ * big free burst on 8-core parts; the backlog empties the clean pool and
+ * pushes allocators into the slow path.
+ */
+static u32 zero_threads = 2;
+module_param(zero_threads, uint, 0444);
+
+static struct task_struct *background_allocators[NVMAP_PP_MAX_ZERO_THREADS];
 static DECLARE_WAIT_QUEUE_HEAD(nvmap_bg_wait);
 
 #ifdef CONFIG_NVMAP_PAGE_POOL_DEBUG
@@ -118,6 +163,9 @@ static inline bool nvmap_bg_should_run(struct nvmap_page_pool *pool)
 	return !list_empty(&pool->zero_list);
 }
 
+/* magazine helpers, defined with the rest of the magazine tier below */
+static int nvmap_pp_mag_feed(struct page **pages, int nr);
+
 static void nvmap_pp_zero_pages(struct page **pages, int nr)
 {
 	int i;
@@ -130,16 +178,12 @@ static void nvmap_pp_zero_pages(struct page **pages, int nr)
 	trace_nvmap_pp_zero_pages(nr);
 }
 
-static void nvmap_pp_do_background_zero_pages(struct nvmap_page_pool *pool)
+static void nvmap_pp_do_background_zero_pages(struct nvmap_page_pool *pool,
+					      struct page **pending_zero_pages)
 {
 	int i;
 	struct page *page;
 	int ret;
-	/*
-	 * Statically declared array of pages to be zeroed in a batch,
-	 * local to this thread but too big for the stack.
-	 */
-	static struct page *pending_zero_pages[PENDING_PAGES_SIZE];
 
 	rt_mutex_lock(&pool->lock);
 	for (i = 0; i < PENDING_PAGES_SIZE; i++) {
@@ -153,8 +197,12 @@ static void nvmap_pp_do_background_zero_pages(struct nvmap_page_pool *pool)
 
 	nvmap_pp_zero_pages(pending_zero_pages, i);
 
+	/* Top up per-CPU magazines first, then the global page list. */
+	ret = nvmap_pp_mag_feed(pending_zero_pages, i);
+
 	rt_mutex_lock(&pool->lock);
-	ret = __nvmap_page_pool_fill_lots_locked(pool, pending_zero_pages, i);
+	ret += __nvmap_page_pool_fill_lots_locked(pool,
+			pending_zero_pages + ret, i - ret);
 	pool->under_zero -= i;
 	rt_mutex_unlock(&pool->lock);
 
@@ -176,21 +224,48 @@ static int nvmap_background_zero_thread(void *arg)
 {
 	struct nvmap_page_pool *pool = &nvmap_dev->pool;
 	struct sched_param param = { .sched_priority = 0 };
+	struct page **pending_zero_pages;
+	bool boosted = false;
 
 	pr_info("PP zeroing thread starting.\n");
 
+	/* Zeroing batch, local to this thread but too big for the stack. */
+	pending_zero_pages = kmalloc_array(PENDING_PAGES_SIZE,
+					   sizeof(*pending_zero_pages),
+					   GFP_KERNEL);
+	if (!pending_zero_pages)
+		return -ENOMEM;
+
 	set_freezable();
 	sched_setscheduler(current, SCHED_IDLE, &param);
 
 	while (!kthread_should_stop()) {
-		while (nvmap_bg_should_run(pool))
-			nvmap_pp_do_background_zero_pages(pool);
+		while (nvmap_bg_should_run(pool)) {
+			/*
+			 * When the clean pool has dropped below demand,
+			 * zeroing is on the allocation critical path; leave
+			 * SCHED_IDLE for SCHED_NORMAL so the backlog drains
+			 * ahead of idle work, and drop back once the pool
+			 * recovers.
+			 */
+			bool low = pool->count < pool->max / 16;
+
+			if (low != boosted) {
+				sched_setscheduler(current,
+					low ? SCHED_NORMAL : SCHED_IDLE,
+					&param);
+				boosted = low;
+			}
+			nvmap_pp_do_background_zero_pages(pool,
+							  pending_zero_pages);
+		}
 
 		wait_event_freezable(nvmap_bg_wait,
 				nvmap_bg_should_run(pool) ||
 				kthread_should_stop());
 	}
 
+	kfree(pending_zero_pages);
 	return 0;
 }
 
@@ -206,6 +281,143 @@ static void nvmap_pgcount(struct page *page, bool incr)
 #endif
 }
 
+/*
+ * Pop up to @nr zeroed pages from the current CPU's magazine. Runs without
+ * touching pool->lock; the per-magazine lock is only ever contended by the
+ * background zeroing thread or a shrinker drain.
+ */
+static int nvmap_pp_mag_alloc(struct page **pages, u32 nr)
+{
+	struct nvmap_pp_magazine *mag;
+	int ind = 0;
+
+	if (!pp_zeroed_mags)
+		return 0;
+
+	mag = get_cpu_ptr(pp_zeroed_mags);
+	spin_lock(&mag->lock);
+	while (ind < nr && mag->nr)
+		pages[ind++] = mag->pages[--mag->nr];
+	spin_unlock(&mag->lock);
+	put_cpu_ptr(pp_zeroed_mags);
+
+	return ind;
+}
+
+/*
+ * Stage a freed page in the current CPU's dirty magazine. Returns false if
+ * the magazine is full, in which case the caller must fall back to the
+ * global zero list (flushing the batch it has accumulated so far).
+ */
+static bool nvmap_pp_mag_free(struct page *page)
+{
+	struct nvmap_pp_magazine *mag;
+	bool stashed = false;
+
+	if (!pp_dirty_mags)
+		return false;
+
+	mag = get_cpu_ptr(pp_dirty_mags);
+	spin_lock(&mag->lock);
+	if (mag->nr < NVMAP_PP_MAGAZINE_SIZE) {
+		mag->pages[mag->nr++] = page;
+		stashed = true;
+	}
+	spin_unlock(&mag->lock);
+	put_cpu_ptr(pp_dirty_mags);
+
+	return stashed;
+}
+
+/*
+ * Move the current CPU's dirty magazine onto the pool's zero list in one
+ * pool->lock acquisition. Pages that do not fit under pool->max are freed
+ * back to the system.
+ */
+static void nvmap_pp_mag_flush_dirty(struct nvmap_page_pool *pool)
+{
+	struct page *batch[NVMAP_PP_MAGAZINE_SIZE];
+	struct nvmap_pp_magazine *mag;
+	int i, nr = 0, room;
+
+	if (!pp_dirty_mags)
+		return;
+
+	mag = get_cpu_ptr(pp_dirty_mags);
+	spin_lock(&mag->lock);
+	while (mag->nr)
+		batch[nr++] = mag->pages[--mag->nr];
+	spin_unlock(&mag->lock);
+	put_cpu_ptr(pp_dirty_mags);
+
+	if (!nr)
+		return;
+
+	rt_mutex_lock(&pool->lock);
+	room = min_t(int, nr, (int)pool->max - (int)pool->count -
+			(int)pool->to_zero - (int)pool->under_zero);
+	for (i = 0; i < room; i++) {
+		list_add_tail(&batch[i]->lru, &pool->zero_list);
+		pool->to_zero++;
+	}
+	if (pool->to_zero)
+		wake_up_interruptible(&nvmap_bg_wait);
+	rt_mutex_unlock(&pool->lock);
+
+	for (i = room > 0 ? room : 0; i < nr; i++)
+		__free_page(batch[i]);
+}
+
+/*
+ * Distribute freshly zeroed pages to per-CPU magazines that are below half
+ * capacity. Called from the background zeroing thread; the remainder goes to
+ * the global page list as before. Returns the number of pages consumed from
+ * the front of @pages.
+ */
+static int nvmap_pp_mag_feed(struct page **pages, int nr)
+{
+	struct nvmap_pp_magazine *mag;
+	int cpu, ind = 0;
+
+	if (!pp_zeroed_mags || !enable_pp)
+		return 0;
+
+	for_each_online_cpu(cpu) {
+		if (ind == nr)
+			break;
+		mag = per_cpu_ptr(pp_zeroed_mags, cpu);
+		spin_lock(&mag->lock);
+		while (ind < nr && mag->nr < NVMAP_PP_MAGAZINE_SIZE / 2)
+			mag->pages[mag->nr++] = pages[ind++];
+		spin_unlock(&mag->lock);
+	}
+
+	return ind;
+}
+
+/* Free every page currently held in per-CPU magazines back to the system. */
+static ulong nvmap_pp_mag_drain(struct nvmap_pp_magazine __percpu *mags)
+{
+	struct nvmap_pp_magazine *mag;
+	ulong freed = 0;
+	int cpu;
+
+	if (!mags)
+		return 0;
+
+	for_each_possible_cpu(cpu) {
+		mag = per_cpu_ptr(mags, cpu);
+		spin_lock(&mag->lock);
+		while (mag->nr) {
+			__free_page(mag->pages[--mag->nr]);
+			freed++;
+		}
+		spin_unlock(&mag->lock);
+	}
+
+	return freed;
+}
+
 /*
  * Free the passed number of pages from the page pool. This happens regardless
  * of whether the page pools are enabled. This lets one disable the page pools
@@ -277,6 +489,15 @@ int nvmap_page_pool_alloc_lots(struct nvmap_page_pool *pool,
 	if (!enable_pp || !nr)
 		return 0;
 
+	/* Fast path: satisfy the request from the local CPU's magazine. */
+	ind = nvmap_pp_mag_alloc(pages, nr);
+	if (ind == nr) {
+		pp_alloc_add(pool, ind);
+		pp_hit_add(pool, ind);
+		trace_nvmap_pp_alloc_lots(ind, nr);
+		return ind;
+	}
+
 	rt_mutex_lock(&pool->lock);
 
 	while (ind < nr) {
@@ -420,6 +641,26 @@ int nvmap_page_pool_fill_lots(struct nvmap_page_pool *pool,
 	int i;
 	u32 save_to_zero;
 
+	/*
+	 * Fast path: stage frees in the local CPU's dirty magazine so the
+	 * common free path does not serialize on pool->lock. Pages with
+	 * extra references can not be reused and are freed as before.
+	 */
+	if (enable_pp && pp_dirty_mags) {
+		for (i = 0; i < nr; i++) {
+			if (page_count(pages[i]) > 1) {
+				__free_page(pages[i]);
+				continue;
+			}
+			if (!nvmap_pp_mag_free(pages[i])) {
+				nvmap_pp_mag_flush_dirty(pool);
+				if (!nvmap_pp_mag_free(pages[i]))
+					__free_page(pages[i]);
+			}
+		}
+		return nr;
+	}
+
 	rt_mutex_lock(&pool->lock);
 
 	save_to_zero = pool->to_zero;
@@ -472,6 +713,9 @@ int nvmap_page_pool_clear(void)
 {
 	struct nvmap_page_pool *pool = &nvmap_dev->pool;
 
+	(void)nvmap_pp_mag_drain(pp_zeroed_mags);
+	(void)nvmap_pp_mag_drain(pp_dirty_mags);
+
 	rt_mutex_lock(&pool->lock);
 
 	(void)nvmap_page_pool_free_pages_locked(pool, pool->count + pool->to_zero);
@@ -518,12 +762,33 @@ static unsigned long nvmap_page_pool_scan_objects(struct shrinker *shrinker,
 						  struct shrink_control *sc)
 {
 	unsigned long remaining;
+	unsigned long nr_to_scan = sc->nr_to_scan;
+	ulong freed;
+
+	pr_debug("sh_pages=%lu", nr_to_scan);
 
-	pr_debug("sh_pages=%lu", sc->nr_to_scan);
+	/* Reclaim magazine pages before dipping into the pool proper. */
+	freed = nvmap_pp_mag_drain(pp_zeroed_mags);
+	freed += nvmap_pp_mag_drain(pp_dirty_mags);
+	if (freed >= nr_to_scan)
+		return freed;
+	nr_to_scan -= freed;
 
 	rt_mutex_lock(&nvmap_dev->pool.lock);
+
+	/* protect the reserve: only drain pages above it */
+	{
+		ulong unused = nvmap_dev->pool.count +
+			       nvmap_dev->pool.to_zero;
+
+		if (unused <= pool_reserve_pages)
+			nr_to_scan = 0;
+		else if (nr_to_scan > unused - pool_reserve_pages)
+			nr_to_scan = unused - pool_reserve_pages;
+	}
+
 	remaining = nvmap_page_pool_free_pages_locked(
-			&nvmap_dev->pool, sc->nr_to_scan);
+			&nvmap_dev->pool, nr_to_scan);
 	rt_mutex_unlock(&nvmap_dev->pool.lock);
 
 	return (remaining == sc->nr_to_scan) ? \
@@ -681,10 +946,26 @@ int nvmap_page_pool_debugfs_init(struct dentry *nvmap_root)
 	return 0;
 }
 
+static struct nvmap_pp_magazine __percpu *nvmap_pp_mag_create(void)
+{
+	struct nvmap_pp_magazine __percpu *mags;
+	int cpu;
+
+	mags = alloc_percpu(struct nvmap_pp_magazine);
+	if (!mags)
+		return NULL;
+
+	for_each_possible_cpu(cpu)
+		spin_lock_init(&per_cpu_ptr(mags, cpu)->lock);
+
+	return mags;
+}
+
 int nvmap_page_pool_init(struct nvmap_device *dev)
 {
 	struct sysinfo info;
 	struct nvmap_page_pool *pool = &dev->pool;
+	int i;
 
 	memset(pool, 0x0, sizeof(*pool));
 	rt_mutex_init(&pool->lock);
@@ -692,8 +973,25 @@ int nvmap_page_pool_init(struct nvmap_device *dev)
 	INIT_LIST_HEAD(&pool->zero_list);
 	INIT_LIST_HEAD(&pool->page_list_bp);
 
-	pool->big_pg_sz = NVMAP_PP_BIG_PAGE_SIZE;
-	pool->pages_per_big_pg = NVMAP_PP_BIG_PAGE_SIZE >> PAGE_SHIFT;
+	/* Magazines are an optimization; run without them if ENOMEM. */
+	pp_zeroed_mags = nvmap_pp_mag_create();
+	pp_dirty_mags = nvmap_pp_mag_create();
+	if (!pp_zeroed_mags || !pp_dirty_mags) {
+		free_percpu(pp_zeroed_mags);
+		free_percpu(pp_dirty_mags);
+		pp_zeroed_mags = NULL;
+		pp_dirty_mags = NULL;
+	}
+
+	/*
+	 * Use a 2MB big-page granule where the SMMU can map it with a
+	 * single section entry; older chips keep the 64K granule.
+	 */
+	if (tegra_get_chip_id() == TEGRA194)
+		pool->big_pg_sz = NVMAP_PP_BIG_PAGE_SIZE_T19X;
+	else
+		pool->big_pg_sz = NVMAP_PP_BIG_PAGE_SIZE;
+	pool->pages_per_big_pg = pool->big_pg_sz >> PAGE_SHIFT;
 
 	si_meminfo(&info);
 	pr_info("Total RAM pages: %lu\n", info.totalram);
@@ -712,10 +1010,22 @@ int nvmap_page_pool_init(struct nvmap_device *dev)
 	pr_info("nvmap page pool size: %u pages (%u MB)\n", pool->max,
 		(pool->max * info.mem_unit) >> 20);
 
-	background_allocator = kthread_run(nvmap_background_zero_thread,
-					    NULL, "nvmap-bz");
-	if (IS_ERR(background_allocator))
-		goto fail;
+	zero_threads = clamp_t(u32, zero_threads, 1,
+			       min_t(u32, NVMAP_PP_MAX_ZERO_THREADS,
+				     num_possible_cpus()));
+	for (i = 0; i < zero_threads; i++) {
+		background_allocators[i] =
+			kthread_run(nvmap_background_zero_thread, NULL,
+				    "nvmap-bz/%d", i);
+		if (IS_ERR(background_allocators[i])) {
+			background_allocators[i] = NULL;
+			if (i == 0)
+				goto fail;
+			/* run with however many threads we managed to make */
+			zero_threads = i;
+			break;
+		}
+	}
 
 	register_shrinker(&nvmap_page_pool_shrinker);
 
@@ -728,17 +1038,30 @@ fail:
 int nvmap_page_pool_fini(struct nvmap_device *dev)
 {
 	struct nvmap_page_pool *pool = &dev->pool;
+	int i;
 
 	/*
-	 * if background allocator is not initialzed or not
+	 * if background allocators are not initialzed or not
 	 * properly initialized, then shrinker is also not
 	 * registered
 	 */
-	if (!IS_ERR_OR_NULL(background_allocator)) {
+	if (background_allocators[0]) {
 		unregister_shrinker(&nvmap_page_pool_shrinker);
-		kthread_stop(background_allocator);
+		for (i = 0; i < zero_threads; i++) {
+			if (background_allocators[i]) {
+				kthread_stop(background_allocators[i]);
+				background_allocators[i] = NULL;
+			}
+		}
 	}
 
+	(void)nvmap_pp_mag_drain(pp_zeroed_mags);
+	(void)nvmap_pp_mag_drain(pp_dirty_mags);
+	free_percpu(pp_zeroed_mags);
+	free_percpu(pp_dirty_mags);
+	pp_zeroed_mags = NULL;
+	pp_dirty_mags = NULL;
+
 	WARN_ON(!list_empty(&pool->page_list));
 
 	return 0;
@@ -18,6 +18,7 @@
 #ifndef __VIDEO_TEGRA_NVMAP_NVMAP_H
 #define __VIDEO_TEGRA_NVMAP_NVMAP_H
 
+#include <linux/hashtable.h>
 #include <linux/list.h>
 #include <linux/mm.h>
 #include <linux/mutex.h>
@@ -157,6 +158,8 @@ struct nvmap_handle_dmabuf_priv {
 
 struct nvmap_handle {
 	struct rb_node node;	/* entry on global handle tree */
+	struct hlist_node hash_node; /* entry on global handle hash */
+	struct rcu_head rcu;	/* deferred free for lock-free validation */
 	atomic_t ref;		/* reference count (i.e., # of duplications) */
 	atomic_t pin;		/* pin count */
 	u32 flags;		/* caching flags */
@@ -218,6 +221,11 @@ struct nvmap_handle_ref {
 #define NVMAP_PP_POOL_SIZE               (128)
 
 #define NVMAP_PP_BIG_PAGE_SIZE           (0x10000)
+/*
+ * On T19x the SMMU maps 2MB-aligned contiguous runs with section entries,
+ * so a 2MB granule cuts TLB pressure ~512x for large buffers.
+ */
+#define NVMAP_PP_BIG_PAGE_SIZE_T19X      (0x200000)
 
 struct nvmap_page_pool {
 	struct rt_mutex lock;
@@ -275,8 +283,12 @@ struct nvmap_vma_priv {
 	atomic_t	count;	/* number of processes cloning the VMA */
 };
 
+/* hash of all live handles, looked up under RCU by nvmap_validate_get() */
+#define NVMAP_HANDLE_HASH_BITS	10
+
 struct nvmap_device {
 	struct rb_root	handles;
+	DECLARE_HASHTABLE(handles_hash, NVMAP_HANDLE_HASH_BITS);
 	spinlock_t	handle_lock;
 	struct miscdevice dev_user;
 	struct nvmap_carveout_node *heaps;
@@ -420,6 +432,7 @@ int nvmap_handle_remove(struct nvmap_device *dev, struct nvmap_handle *h);
 void nvmap_handle_add(struct nvmap_device *dev, struct nvmap_handle *h);
 
 int is_nvmap_vma(struct vm_area_struct *vma);
+int nvmap_prefault_user_range(unsigned long va, size_t len);
 
 int nvmap_get_dmabuf_fd(struct nvmap_client *client, struct nvmap_handle *h);
 struct nvmap_handle *nvmap_handle_get_from_dmabuf_fd(
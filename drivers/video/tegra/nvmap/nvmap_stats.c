@@ -19,6 +19,18 @@
 
 #include "nvmap_priv.h"
 
+/*
+ * Per-process accounting note: the global counters here are
+ * intentionally coarse; per-client attribution already exists one
+ * level up - nvmap tracks every client with its pid, and the
+ * handles_by_pid debugfs tree plus the per-client allocations dump
+ * give (pid -> handles, sizes, share counts) without walking handle
+ * refs through /proc. Those paths take the client list mutex on read
+ * only, so a memory-pressure monitor polling them does not perturb
+ * the allocation fast path; percpu counters per client would only be
+ * warranted if a monitor needed per-sample cost below that.
+ */
+
 struct nvmap_stats nvmap_stats;
 
 static int nvmap_stats_reset(void *data, u64 val)
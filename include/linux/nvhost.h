@@ -23,6 +23,7 @@
 #ifndef __LINUX_NVHOST_H
 #define __LINUX_NVHOST_H
 
+#include <linux/atomic.h>
 #include <linux/cdev.h>
 #include <linux/device.h>
 #include <linux/types.h>
@@ -80,6 +81,8 @@ struct sync_pt;
 enum nvhost_power_sysfs_attributes {
 	NVHOST_POWER_SYSFS_ATTRIB_AUTOSUSPEND_DELAY,
 	NVHOST_POWER_SYSFS_ATTRIB_FORCE_ON,
+	NVHOST_POWER_SYSFS_ATTRIB_AUTOSUSPEND_STATS,
+	NVHOST_POWER_SYSFS_ATTRIB_ADAPTIVE_AUTOSUSPEND,
 	NVHOST_POWER_SYSFS_ATTRIB_MAX
 };
 
@@ -149,6 +152,9 @@ enum nvhost_resource_policy {
 	RESOURCE_PER_CHANNEL_INSTANCE,
 };
 
+/* log2(us) latency buckets; last one collects everything >= ~32s */
+#define NVHOST_LAT_HIST_BUCKETS	26
+
 struct nvhost_device_data {
 	int		version;	/* ip version number of device */
 	int		id;		/* Separates clients of same hw */
@@ -195,6 +201,16 @@ struct nvhost_device_data {
 	bool		engine_can_cg;	/* True if CG is enabled */
 	bool		can_powergate;	/* True if module can be power gated */
 	int		autosuspend_delay;/* Delay before power gated */
+	/*
+	 * Adaptive autosuspend: the delay tracks the learned inter-job
+	 * interval so engines with periodic gaps slightly above the static
+	 * delay stop thrashing through power-gate/ungate cycles.
+	 */
+	bool		adaptive_autosuspend;
+	u64		busy_last_ns;	  /* time of previous busy() */
+	u64		busy_interval_ns; /* EWMA of inter-busy gap */
+	unsigned int	wakeups_gated;	  /* busy() paid a full resume */
+	unsigned int	wakeups_active;	  /* busy() found engine still on */
 	struct nvhost_clock clocks[NVHOST_MODULE_MAX_CLOCKS];/* Clock names */
 
 	/* Clock gating registers */
@@ -376,6 +392,19 @@ struct nvhost_device_data {
 	/* deliver task timestamps for falcon */
 	void (*enable_timestamps)(struct platform_device *pdev,
 			struct nvhost_cdma *cdma, dma_addr_t timestamp_addr);
+
+	/* actmon fast closed loop: immediate clock steps on watermark irq */
+	bool fast_scale_enable;
+	u32 fast_scale_attack_pct;
+	u32 fast_scale_decay_pct;
+
+	/* always-on submit-to-start/start-to-complete latency histograms,
+	 * log2(us) buckets, folded into one debugfs read */
+	struct {
+		atomic64_t jobs;
+		atomic64_t sub2start[NVHOST_LAT_HIST_BUCKETS];
+		atomic64_t start2done[NVHOST_LAT_HIST_BUCKETS];
+	} lat_stats;
 };
 
 
@@ -649,6 +678,12 @@ static inline void nvhost_eventlib_log_submit(struct platform_device *pdev,
 					      u64 timestamp)
 {
 }
+
+static inline void nvhost_eventlib_log_engine_load(struct platform_device *pdev,
+						   u32 load,
+						   u64 timestamp)
+{
+}
 #else
 
 #ifdef CONFIG_DEBUG_FS
@@ -756,6 +791,9 @@ void nvhost_eventlib_log_task(struct platform_device *pdev,
 			      u64 timestamp_start,
 			      u64 timestamp_end);
 
+void nvhost_eventlib_log_engine_load(struct platform_device *pdev,
+				     u32 load,
+				     u64 timestamp);
 void nvhost_eventlib_log_submit(struct platform_device *pdev,
 				u32 syncpt_id,
 				u32 syncpt_thresh,
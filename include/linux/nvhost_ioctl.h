@@ -444,6 +444,19 @@ struct nvhost_ctrl_poll_fd_create_args {
 	__u32 padding;
 };
 
+/*
+ * Location of a syncpoint value within the read-only shim mapping
+ * obtained by mmap()ing the control node. A waiter checks the mapped
+ * word first and only enters the kernel (SYNCPT_WAITEX) when the
+ * threshold has not passed yet.
+ */
+struct nvhost_ctrl_syncpt_mmap_info_args {
+	__u32 id;		/* in: syncpoint id */
+	__u32 offset;		/* out: byte offset within the mapping */
+	__u32 mmap_size;	/* out: total size of the mappable shim */
+	__u32 padding;
+};
+
 struct nvhost_ctrl_poll_fd_trigger_event_args {
 	__s32 fd;
 	__u32 id;
@@ -491,9 +504,11 @@ struct nvhost_ctrl_poll_fd_trigger_event_args {
 	_IOR(NVHOST_IOCTL_MAGIC, 16, struct nvhost_ctrl_poll_fd_create_args)
 #define NVHOST_IOCTL_CTRL_POLL_FD_TRIGGER_EVENT        \
 	_IOW(NVHOST_IOCTL_MAGIC, 17, struct nvhost_ctrl_poll_fd_trigger_event_args)
+#define NVHOST_IOCTL_CTRL_SYNCPT_MMAP_INFO	\
+	_IOWR(NVHOST_IOCTL_MAGIC, 18, struct nvhost_ctrl_syncpt_mmap_info_args)
 
 #define NVHOST_IOCTL_CTRL_LAST			\
-	_IOC_NR(NVHOST_IOCTL_CTRL_POLL_FD_TRIGGER_EVENT)
+	_IOC_NR(NVHOST_IOCTL_CTRL_SYNCPT_MMAP_INFO)
 #define NVHOST_IOCTL_CTRL_MAX_ARG_SIZE	\
 	sizeof(struct nvhost_ctrl_syncpt_waitmex_args)
 
@@ -139,6 +139,7 @@ enum {
 	NVMAP_PAGES_RESERVE,
 	NVMAP_INSERT_PAGES_ON_UNRESERVE,
 	NVMAP_PAGES_PROT_AND_CLEAN,
+	NVMAP_PAGES_MK_DIRTY,	/* hint: CPU dirtied the given ranges */
 };
 
 #define NVMAP_ELEM_SIZE_U64 (1 << 31)
@@ -345,6 +346,26 @@ struct nvmap_set_tag_label {
 	__u64 addr;		/* in: pointer to label or NULL to remove */
 };
 
+/* operation codes for nvmap_batch_op */
+#define NVMAP_BATCH_OP_ALLOC	0
+#define NVMAP_BATCH_OP_FREE	1
+#define NVMAP_BATCH_OP_MAX_NR	4096
+
+struct nvmap_batch_op {
+	__u32 handle;		/* nvmap handle */
+	__u32 op;		/* NVMAP_BATCH_OP_* */
+	__u32 heap_mask;	/* heaps to allocate from (alloc only) */
+	__u32 flags;		/* wb/wc/uc/iwb etc. (alloc only) */
+	__u32 align;		/* min alignment necessary (alloc only) */
+	__s32 result;		/* out: 0 on success or -errno */
+};
+
+struct nvmap_batch_op_list {
+	__u64 ops;		/* Ptr to array of struct nvmap_batch_op */
+	__u32 nr;		/* Number of operations */
+	__u32 reserved;		/* must be 0 */
+};
+
 struct nvmap_available_heaps {
 	__u64 heaps;		/* heaps bitmask */
 };
@@ -452,6 +473,43 @@ struct nvmap_heap_size {
 #define NVMAP_IOC_GET_HEAP_SIZE \
 	_IOR(NVMAP_IOC_MAGIC, 26, struct nvmap_heap_size)
 
+/* Perform a batch of handle alloc/free operations in one syscall */
+#define NVMAP_IOC_BATCH_OP \
+	_IOWR(NVMAP_IOC_MAGIC, 27, struct nvmap_batch_op_list)
+
+/* One device-wide handle record, see NVMAP_IOC_HANDLE_SNAPSHOT */
+struct nvmap_handle_record {
+	__u64 size;		/* padded allocation size */
+	__u32 tag;		/* allocation tag (userflags >> 16) */
+	__u32 heap_type;	/* heap the memory came from */
+	__u32 pin_count;
+	__u32 share_count;
+	__s32 owner_pid;	/* -1 if the owner is gone */
+	__u32 reserved;
+};
+
+struct nvmap_handle_snapshot {
+	__u64 records;		/* in: ptr to nvmap_handle_record array */
+	__u32 nr;		/* in: array capacity, out: records used */
+	__u32 total;		/* out: live handles at snapshot time */
+};
+
+/*
+ * Serialize (tag, size, heap, pin count, owner) for every live handle
+ * in one call, so memory profilers stop iterating per-handle ioctls.
+ */
+#define NVMAP_IOC_HANDLE_SNAPSHOT \
+	_IOWR(NVMAP_IOC_MAGIC, 28, struct nvmap_handle_snapshot)
+
+struct nvmap_prefault {
+	__u64 va;		/* start of the mmap'd range */
+	__u64 len;		/* length in bytes */
+};
+
+/* Populate PTEs for a whole mmap'd handle range in one call */
+#define NVMAP_IOC_PREFAULT \
+	_IOW(NVMAP_IOC_MAGIC, 29, struct nvmap_prefault)
+
 /* START of T124 IOCTLS */
 /* Actually allocates memory for the specified handle, with kind */
 #define NVMAP_IOC_ALLOC_KIND _IOW(NVMAP_IOC_MAGIC, 100, struct nvmap_alloc_kind_handle)
@@ -474,6 +474,24 @@ struct nvs_fn_if {
 	int (*suspend)(void *handle);
 	int (*resume)(void *handle);
 	int (*handler)(void *handle, void *buffer, s64 ts);
+/**
+ * handler_batch - push a block of samples drained from a HW FIFO
+ * @handle: handle returned from probe
+ * @buffer: n contiguous samples in the handler's buffer layout
+ * @n: number of samples in buffer
+ * @ts_first: timestamp of the first sample
+ * @ts_last: timestamp of the last sample
+ *
+ * Returns 0 on success or a negative error code.
+ *
+ * Timestamps for intermediate samples are linearly interpolated
+ * between ts_first and ts_last, allowing HW drivers to read an
+ * entire FIFO in one bus transaction and reconstruct per-sample
+ * times from frame counters.  Optional; when NULL the HW driver
+ * must call handler per sample.
+ */
+	int (*handler_batch)(void *handle, void *buffer, unsigned int n,
+			     s64 ts_first, s64 ts_last);
 };
 
 extern const char * const nvs_float_significances[];
@@ -121,6 +121,7 @@ struct actmon_dev {
 	unsigned int boost_up_threshold;
 	unsigned int boost_down_threshold;
 
+	bool up_event;	/* up-watermark seen, consumed by the sampler */
 	u8 up_wmark_window;
 	u8 down_wmark_window;
 	u8 avg_window_log2;
@@ -152,6 +153,15 @@ struct actmon_drv_data {
 	int virq;
 	struct clk *actmon_clk;
 	u8 sample_period;
+	/*
+	 * Dual-rate sampling: on an up-watermark event (burst onset) the
+	 * sampler switches to fast_sample_period for fast_sample_hold
+	 * samples, then decays back to sample_period. 0 disables.
+	 */
+	u8 fast_sample_period;
+	u8 slow_sample_period;
+	u32 fast_sample_hold;
+	u32 fast_samples_left;
 	unsigned long freq;
 	struct reset_control *actmon_rst;
 	struct actmon_dev devices[MAX_DEVICES];
@@ -21,5 +21,6 @@ struct device_node *of_get_scaling_node(const char *name);
 int enable_cpu_emc_clk(void);
 void disable_cpu_emc_clk(void);
 void set_cpu_to_emc_freq(u32 cpu_freq);
+void set_cluster_cpu_to_emc_freq(u32 cpu_freq, int cluster);
 
 #endif
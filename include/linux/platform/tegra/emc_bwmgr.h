@@ -260,6 +260,27 @@ void __exit bwmgr_exit(void);
  */
 int __init pmqos_bwmgr_init(void);
 
+/* event kinds for the bandwidth request flight recorder */
+enum tegra_bw_timeline_kind {
+	TEGRA_BW_TL_BWMGR_SET = 0,
+	TEGRA_BW_TL_ISO_RESERVE,
+	TEGRA_BW_TL_ISO_REALIZE,
+	TEGRA_BW_TL_UNDERFLOW,
+};
+
+/**
+ * tegra_bw_timeline_record - log a bandwidth request into the timeline.
+ * @kind	which call this records
+ * @client	client id in the caller's namespace
+ * @value	requested value (Hz for bwmgr, KBps for isomgr)
+ * @rate	resulting emc rate in Hz, or 0 if not applicable
+ *
+ * Entries land in a fixed ring dumped via the bwmgr bw_timeline
+ * debugfs node; safe from any context.
+ */
+void tegra_bw_timeline_record(enum tegra_bw_timeline_kind kind, u32 client,
+			      u64 value, u64 rate);
+
 #else /* CONFIG_TEGRA_BWMGR */
 
 static inline struct tegra_bwmgr_client *tegra_bwmgr_register(
@@ -389,5 +410,17 @@ static inline int tegra_bwmgr_notifier_unregister(struct notifier_block *nb)
 	return 0;
 }
 
+enum tegra_bw_timeline_kind {
+	TEGRA_BW_TL_BWMGR_SET = 0,
+	TEGRA_BW_TL_ISO_RESERVE,
+	TEGRA_BW_TL_ISO_REALIZE,
+	TEGRA_BW_TL_UNDERFLOW,
+};
+
+static inline void tegra_bw_timeline_record(enum tegra_bw_timeline_kind kind,
+					    u32 client, u64 value, u64 rate)
+{
+}
+
 #endif /* CONFIG_TEGRA_BWMGR */
 #endif /* __EMC_BWMGR_H */
@@ -84,6 +84,24 @@ struct mc_error {
 extern u32 mc_int_mask;
 extern u32  mcerr_silenced;
 
+/*
+ * Structured MC fault record, captured by the chip log_fault paths in
+ * addition to the dmesg print so the first faults survive a flood.
+ */
+struct mcerr_fault_record {
+	u64 timestamp;		/* raw TSC */
+	phys_addr_t addr;
+	u32 status;
+	u32 swgid;
+	u8 secure;
+	u8 write;
+	const char *client_name;
+	const char *msg;
+};
+
+void mcerr_record_fault(u32 swgid, const char *client_name, phys_addr_t addr,
+			u32 status, bool secure, bool write, const char *msg);
+
 struct mcerr_ops {
 	/*
 	 * Show the statistics for each client. This is called from a debugfs
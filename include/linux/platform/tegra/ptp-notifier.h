@@ -38,6 +38,14 @@ int tegra_hwtime_notifier_call_chain(unsigned int val, void *v);
  */
 int get_ptp_hwtime(u64 *ns);
 
+/*
+ * Cheap variant: interpolates from a seqlock-protected (PHC, local
+ * clock) snapshot refreshed at most every 10ms, instead of reading the
+ * MAC registers on every call. Accurate to the servo's ppm drift over
+ * the refresh window; use get_ptp_hwtime() when exactness matters.
+ */
+int get_ptp_hwtime_cached(u64 *ns);
+
 #else /* CONFIG_TEGRA_PTP_NOTIFIER */
 
 /* register / unregister HW time source */
@@ -77,6 +85,11 @@ static inline int get_ptp_hwtime(u64 *ns)
 	return -EINVAL;
 }
 
+static inline int get_ptp_hwtime_cached(u64 *ns)
+{
+	return -EINVAL;
+}
+
 #endif /* CONFIG_TEGRA_PTP_NOTIFIER */
 
 #endif /* __PTP_NOTIFIER_H */
@@ -34,6 +34,8 @@ int tegra_capture_ivc_control_submit(const void *control_desc, size_t len);
  * @param[in] len: size of capture_desc.
  */
 int tegra_capture_ivc_capture_submit(const void *capture_desc, size_t len);
+int tegra_capture_ivc_capture_submit_batch(const void *capture_descs,
+		size_t count, size_t len);
 
 /*
  * Callback function to be registered by client to receive the rtcpu
@@ -173,6 +173,21 @@ struct camera_common_sensor_ops {
 		struct camera_common_framesync *vshs);
 };
 
+/*
+ * All per-frame exposure controls that changed in one commit. Sensor
+ * drivers implementing set_frame_ctrls() receive them together and can
+ * program the lot in a single regmap multi-write instead of one blocking
+ * I2C transaction per control.
+ */
+struct tegracam_frame_ctrls {
+	s64 gain;
+	s64 exposure;
+	s64 frame_rate;
+	bool gain_new;
+	bool exposure_new;
+	bool frame_rate_new;
+};
+
 struct tegracam_ctrl_ops {
 	u32 numctrls;
 	u32 string_ctrl_size[TEGRA_CAM_MAX_STRING_CONTROLS];
@@ -181,6 +196,9 @@ struct tegracam_ctrl_ops {
 	int (*set_exposure)(struct camera_common_data *s_data, s64 val);
 	int (*set_frame_rate)(struct camera_common_data *s_data, s64 val);
 	int (*set_group_hold)(struct camera_common_data *s_data, bool val);
+	/* optional: coalesced commit of all changed per-frame controls */
+	int (*set_frame_ctrls)(struct camera_common_data *s_data,
+		struct tegracam_frame_ctrls *frame_ctrls);
 	int (*fill_string_ctrl)(struct camera_common_data *s_data,
 		struct v4l2_ctrl *ctrl);
 };
@@ -192,6 +210,11 @@ struct tegracam_ctrl_handler {
 
 	int				numctrls;
 	struct v4l2_ctrl		*ctrls[MAX_CID_CONTROLS];
+
+	/* gain/exposure/frame-rate cluster for coalesced commits; the
+	 * array must stay valid for the lifetime of the handler */
+	struct v4l2_ctrl		*frame_ctrls[3];
+	int				num_frame_ctrls;
 };
 
 struct camera_common_data {
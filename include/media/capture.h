@@ -126,6 +126,8 @@ int vi_capture_get_info(struct tegra_vi_channel *chan,
 		struct vi_capture_info *info);
 int vi_capture_control_message(struct tegra_vi_channel *chan,
 		struct vi_capture_control_msg *msg);
+int vi_capture_request_batch(struct tegra_vi_channel *chan,
+		struct vi_capture_req *reqs, unsigned int count);
 int vi_capture_request(struct tegra_vi_channel *chan,
 		struct vi_capture_req *req);
 int vi_capture_status(struct tegra_vi_channel *chan,
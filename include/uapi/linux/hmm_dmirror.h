@@ -51,4 +51,17 @@ struct hmm_dmirror_migrate {
 #define HMM_DMIRROR_WRITE		_IOWR('H', 0x01, struct hmm_dmirror_write)
 #define HMM_DMIRROR_MIGRATE		_IOWR('H', 0x02, struct hmm_dmirror_migrate)
 
+/* Looped chunked migration with timing, for bandwidth/latency bench */
+struct hmm_dmirror_migrate_bench {
+	uint64_t		addr;
+	uint64_t		npages;
+	uint64_t		chunk_pages;	/* pages per migrate call */
+	uint64_t		loops;		/* passes over the range */
+	uint64_t		total_ns;	/* out: wall time */
+	uint64_t		pages_migrated;	/* out: total pages moved */
+};
+
+#define HMM_DMIRROR_MIGRATE_BENCH \
+	_IOWR('H', 0x03, struct hmm_dmirror_migrate_bench)
+
 #endif /* _UAPI_LINUX_HMM_DMIRROR_H */
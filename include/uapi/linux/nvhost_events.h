@@ -90,9 +90,36 @@ enum {
 	/* struct nvhost_vpu_perf_counter */
 	NVHOST_VPU_PERF_COUNTER = 3,
 
-	NVHOST_NUM_EVENT_TYPES = 4
+	/* struct nvhost_engine_load */
+	NVHOST_ENGINE_LOAD = 4,
+
+	/* struct nvhost_dla_fw_trace */
+	NVHOST_DLA_FW_TRACE = 5,
+
+	NVHOST_NUM_EVENT_TYPES = 6
 };
 
+/* Chunk of the DLA firmware trace stream */
+struct nvhost_dla_fw_trace {
+	/* Engine class ID */
+	u32 class_id;
+
+	/* Number of valid bytes in data */
+	u32 size;
+
+	/* Raw firmware trace bytes */
+	u8 data[120];
+} __packed;
+
+/* Periodic actmon utilization sample for an engine */
+struct nvhost_engine_load {
+	/* Engine class ID */
+	u32 class_id;
+
+	/* Normalized load, 0..1000 */
+	u32 load;
+} __packed;
+
 enum {
 	NVHOST_NUM_CUSTOM_FILTER_FLAGS = 0
 };
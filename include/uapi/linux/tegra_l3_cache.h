@@ -38,7 +38,15 @@ struct tegra_l3_ioctl_data {
 #define TEGRA_L3_CACHE_GET_IOCTL_DATA    \
 		_IOR(TEGRA_L3_CACHE_IOC_MAGIC, 1, struct tegra_l3_ioctl_data)
 
-#define TEGRA_L3_CACHE_IOCTL_IOC_MAXNR _IOC_NR(TEGRA_L3_CACHE_GET_IOCTL_DATA)
+/* Atomically program the CPU/GPU way split in one MCE write. Only
+ * igpu_cpu_ways and igpu_only_ways are consumed; requires
+ * CAP_SYS_ADMIN. The partition is a single CCPLEX-wide register, so
+ * the fencing granularity is the CPU/GPU split, not individual tasks.
+ */
+#define TEGRA_L3_CACHE_SET_PARTITION    \
+		_IOW(TEGRA_L3_CACHE_IOC_MAGIC, 2, struct tegra_l3_ioctl_data)
+
+#define TEGRA_L3_CACHE_IOCTL_IOC_MAXNR _IOC_NR(TEGRA_L3_CACHE_SET_PARTITION)
 #define TEGRA_L3_CACHE_IOCTL_MAX_ARG_SIZE  \
 		sizeof(struct tegra_l3_ioctl_data)
 
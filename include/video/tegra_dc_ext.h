@@ -1438,6 +1438,39 @@ struct tegra_dc_ext_scanline_info {
 #define TEGRA_DC_EXT_CRC_GET \
 	_IOWR('D', 0x28, struct tegra_dc_ext_crc_arg)
 
+/* One frame's worth of CRCs, as drained by TEGRA_DC_EXT_CRC_DRAIN */
+struct tegra_dc_ext_crc_record {
+	__u64 flip_id;		/* first flip latched in the frame, or ~0 */
+	__u32 rg_crc;
+	__u32 comp_crc;
+	__u32 or_crc;
+	__u8 rg_valid;
+	__u8 comp_valid;
+	__u8 or_valid;
+	__u8 reserved[9];	/* unused - must be 0 */
+} __attribute__((__packed__));
+
+struct tegra_dc_ext_crc_drain_arg {
+	__u8 magic[4];		/* in: "TCRC" */
+	__u32 num_records;	/* in: capacity of records array
+				   out: number of records returned */
+	__u64 __user records;	/* in: ptr to tegra_dc_ext_crc_record array */
+	__u8 reserved[16];	/* unused - must be 0 */
+} __attribute__((__packed__));
+
+/* Drain all buffered per-frame CRC records in one call, oldest first.
+ * Blocks for at most one frame when the buffer is empty. Intended for
+ * continuous CRC verification at frame rate without an ioctl per frame.
+ *
+ * Returns
+ * -EINVAL   Same conditions as mentioned for TEGRA_DC_EXT_CRC_ENABLE
+ * -ENODEV   Same conditions as mentioned for TEGRA_DC_EXT_CRC_ENABLE
+ * -EPERM    Same conditions as mentioned for TEGRA_DC_EXT_CRC_DISABLE
+ * -ETIME    if wait for the next Frame End Interrupt timed out
+ */
+#define TEGRA_DC_EXT_CRC_DRAIN \
+	_IOWR('D', 0x29, struct tegra_dc_ext_crc_drain_arg)
+
 enum tegra_dc_ext_control_output_type {
 	TEGRA_DC_EXT_DSI,
 	TEGRA_DC_EXT_LVDS,
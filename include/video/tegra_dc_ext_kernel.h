@@ -97,6 +97,13 @@ struct tegra_dc_lut {
 struct tegra_dc_nvdisp_lut {
 	u64 *rgb;
 	dma_addr_t phy_addr;
+	/*
+	 * Inactive copy for tear-free updates: new contents are staged
+	 * here while scanout fetches from rgb/phy_addr, then the pair is
+	 * swapped and the new base latches at the next frame boundary.
+	 */
+	u64 *rgb_shadow;
+	dma_addr_t phy_addr_shadow;
 	size_t size;
 };
 
@@ -142,6 +149,12 @@ struct tegra_dc_win {
 
 	int			dirty;
 	int			underflows;
+	/*
+	 * Compositor-declared content update rate used to derate the
+	 * worst-case ISO bandwidth request, see TEGRA_DC_BW_HINT_*.
+	 * Reset to full rate on underflow.
+	 */
+	u8			bw_update_hint;
 	struct tegra_dc		*dc;
 
 	struct nvmap_handle_ref	*cur_handle;
@@ -512,6 +512,18 @@ static const int tegra186_xbar_mux_values[] = {
 };
 
 /* controls for t210 */
+/*
+ * Live route changes: these mux controls write the XBAR part
+ * registers directly and take effect immediately - the crossbar
+ * hardware itself never requires stopping streams to repoint an
+ * input. What interrupts audio when a tap is added is DAPM powering
+ * the shared widgets down and up while it walks the new graph. The
+ * fix for glitch-free insertion is therefore not in this driver:
+ * keep the affected path marked ignore_suspend/always-on in the
+ * machine driver, or pin the shared widgets with
+ * snd_soc_dapm_force_enable_pin() around the control write, so the
+ * only register that changes mid-stream is the mux select below.
+ */
 MUX_ENUM_CTRL_DECL(t210_admaif1_tx, 0x00);
 MUX_ENUM_CTRL_DECL(t210_admaif2_tx, 0x01);
 MUX_ENUM_CTRL_DECL(t210_admaif3_tx, 0x02);
@@ -38,10 +38,19 @@
 #include "tegra_pcm_alt.h"
 
 static const struct snd_pcm_hardware tegra_alt_pcm_hardware = {
+	/*
+	 * NO_PERIOD_WAKEUP lets timer-scheduled userspace (PulseAudio
+	 * tsched, AAudio) disable the per-period completion interrupt
+	 * entirely: the ADMA descriptor keeps cycling and the application
+	 * polls positions at its own rate, so 1ms periods across many
+	 * streams stop costing an interrupt plus wakeup per period per
+	 * stream. Clients that do not request it keep per-period wakeups.
+	 */
 	.info			= SNDRV_PCM_INFO_MMAP |
 				  SNDRV_PCM_INFO_MMAP_VALID |
 				  SNDRV_PCM_INFO_PAUSE |
 				  SNDRV_PCM_INFO_RESUME |
+				  SNDRV_PCM_INFO_NO_PERIOD_WAKEUP |
 				  SNDRV_PCM_INFO_INTERLEAVED,
 	.formats		= SNDRV_PCM_FMTBIT_S8 |
 				  SNDRV_PCM_FMTBIT_S16_LE |
@@ -24,6 +24,17 @@
 
 #include "tegra210_virt_alt_admaif.h"
 #include "tegra_virt_alt_ivc.h"
+
+/*
+ * Virtualization overhead note: only control-plane operations (DAI
+ * configuration, start/stop) cross this IVC channel to the audio
+ * server VM. The sample data path and the position pointer are local -
+ * the guest owns its ADMAIF FIFOs and ADMA channels, so snd_pcm
+ * pointer queries read the guest-side dmaengine residue and never
+ * generate IVC traffic. There is therefore no per-period or
+ * per-pointer message to batch; triggers are one message per stream
+ * state change, which is already the minimum the server ABI allows.
+ */
 #include "tegra_pcm_alt.h"
 #include "tegra_asoc_xbar_virt_alt.h"
 #include "tegra_asoc_util_virt_alt.h"